@@ -0,0 +1,194 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : Tools/ShmLogViewer/src/ShmLogViewer.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Streams log lines from every FrameKit process that publishes a
+//      shared-memory log ring (ShmLogSink). Rings are found through the
+//      "fk_shm_log_directory" segment or named on the command line.
+//
+//      Usage: ShmLogViewer [--once] [--no-color] [fk_shm_log_<pid>_<n> ...]
+//        --once      print what is currently buffered and exit
+//        --no-color  plain output, e.g. when a collector writes it to disk
+// =============================================================================
+
+#include <FrameKit/Debug/ShmLogSink.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace FrameKit;
+
+namespace {
+
+    struct Attached {
+        std::string   segment;
+        FKShmHandle   handle = nullptr;
+        ShmLogRing*   ring = nullptr;
+        std::uint64_t cursor = 0;
+        std::string   pending;        // line assembled from continued slots
+        bool          resync = false; // skip fragments after a gap
+        bool          listed = true;  // still present in the directory
+
+        ~Attached() { SHM::Close(handle); }
+    };
+
+    bool g_Color = true;
+
+    void Emit(const Attached& a, LogLevel level, const std::string& line) {
+        if (g_Color) {
+            std::printf("%s[%s:%u] %s\x1b[0m\n", detail::level_to_ansi(level), a.ring->name, a.ring->pid, line.c_str());
+        }
+        else {
+            std::printf("[%s:%u] %s\n", a.ring->name, a.ring->pid, line.c_str());
+        }
+    }
+
+    // Starts at the oldest record the ring still holds
+    std::unique_ptr<Attached> Attach(const std::string& segment) {
+        auto a = std::make_unique<Attached>();
+        a->segment = segment;
+        a->ring = SHM::OpenTyped<ShmLogRing>(segment.c_str(), &a->handle);
+        if (!a->ring || a->ring->magic != ShmLogRing::kMagic || a->ring->version != ShmLogRing::kVersion) return nullptr;
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        const std::uint64_t head = a->ring->head.load(std::memory_order_acquire);
+        a->cursor = head > ShmLogRing::kSlots ? head - ShmLogRing::kSlots : 0;
+        a->resync = a->cursor != 0;
+        return a;
+    }
+
+    // Returns the number of records lost to overwrites.
+    std::uint64_t Drain(Attached& a) {
+        std::uint64_t lost = 0;
+        const std::uint64_t head = a.ring->head.load(std::memory_order_acquire);
+        if (head - a.cursor > ShmLogRing::kSlots) {
+            lost += head - ShmLogRing::kSlots - a.cursor;
+            a.cursor = head - ShmLogRing::kSlots;
+            a.pending.clear();
+            a.resync = true;
+        }
+
+        ShmLogSlot copy;
+        while (a.cursor < head) {
+            const ShmLogSlot& slot = a.ring->slots[a.cursor & (ShmLogRing::kSlots - 1)];
+            const std::uint64_t expect = 2 * a.cursor + 2;
+
+            const std::uint64_t s1 = slot.stamp.load(std::memory_order_acquire);
+            if (s1 == expect) {
+                copy.unixNs = slot.unixNs;
+                copy.length = slot.length;
+                copy.level = slot.level;
+                copy.flags = slot.flags;
+                std::memcpy(copy.text, slot.text, std::min<std::size_t>(copy.length, sizeof(copy.text)));
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+            if (s1 != expect || slot.stamp.load(std::memory_order_relaxed) != s1) {
+                // The writer lapped us while we were reading; restart one ring behind it
+                const std::uint64_t now = a.ring->head.load(std::memory_order_acquire);
+                const std::uint64_t restart = now > ShmLogRing::kSlots ? now - ShmLogRing::kSlots + 1 : a.cursor + 1;
+                lost += restart - a.cursor;
+                a.cursor = restart;
+                a.pending.clear();
+                a.resync = true;
+                continue;
+            }
+
+            ++a.cursor;
+            const bool continued = (copy.flags & ShmLogSlot::kContinued) != 0;
+            if (a.resync) {
+                a.resync = continued;   // the next slot starts a fresh line
+                continue;
+            }
+            a.pending.append(copy.text, std::min<std::size_t>(copy.length, sizeof(copy.text)));
+            if (!continued) {
+                Emit(a, copy.level, a.pending);
+                a.pending.clear();
+            }
+        }
+        return lost;
+    }
+
+    std::vector<std::string> ListDirectory(ShmLogDirectory* dir) {
+        std::vector<std::string> names;
+        if (!dir) return names;
+        for (const ShmLogDirectory::Entry& e : dir->entries) {
+            const std::uint32_t pid = e.pid.load(std::memory_order_acquire);
+            if (pid == 0 || pid == 0xFFFFFFFFu) continue;
+            names.emplace_back(e.segment, strnlen(e.segment, sizeof(e.segment)));
+        }
+        return names;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bool once = false;
+    std::vector<std::string> explicitSegments;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--once") == 0) once = true;
+        else if (std::strcmp(argv[i], "--no-color") == 0) g_Color = false;
+        else explicitSegments.emplace_back(argv[i]);
+    }
+
+    FKShmHandle dirHandle = nullptr;
+    ShmLogDirectory* dir = nullptr;
+    std::vector<std::unique_ptr<Attached>> rings;
+
+    auto refresh = [&] {
+        if (!dir && explicitSegments.empty()) dir = SHM::OpenTyped<ShmLogDirectory>(kShmLogDirectoryName, &dirHandle);
+        const std::vector<std::string> names = explicitSegments.empty() ? ListDirectory(dir) : explicitSegments;
+
+        for (auto& r : rings) r->listed = false;
+        for (const std::string& name : names) {
+            bool found = false;
+            for (auto& r : rings) if (r->segment == name) { r->listed = found = true; }
+            if (found) continue;
+            if (auto a = Attach(name)) {
+                std::fprintf(stderr, "attached %s (%s, pid %u)\n", name.c_str(), a->ring->name, a->ring->pid);
+                rings.push_back(std::move(a));
+            }
+        }
+    };
+
+    refresh();
+    if (rings.empty() && once) {
+        std::fprintf(stderr, "no shared-memory log rings found\n");
+        return 1;
+    }
+
+    auto lastRefresh = std::chrono::steady_clock::now();
+    for (;;) {
+        for (auto& r : rings) {
+            if (const std::uint64_t lost = Drain(*r))
+                std::fprintf(stderr, "%s: %llu records overwritten before they were read\n", r->segment.c_str(),
+                             static_cast<unsigned long long>(lost));
+        }
+        std::fflush(stdout);
+        if (once) break;
+
+        // Rings that left the directory have been drained above; drop them
+        std::erase_if(rings, [](const std::unique_ptr<Attached>& r) { return !r->listed; });
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastRefresh > std::chrono::milliseconds(250)) {
+            refresh();
+            lastRefresh = now;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    rings.clear();
+    SHM::Close(dirHandle);
+    return 0;
+}
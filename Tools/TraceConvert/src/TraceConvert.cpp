@@ -0,0 +1,74 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : Tools/TraceConvert/src/TraceConvert.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Converts a compact trace (Instrumentor::BeginSession with
+//      TraceFormat::Compact, or a compact flight-recorder dump) into Chrome
+//      trace JSON that chrome://tracing and Perfetto open directly.
+//
+//      Usage: TraceConvert <in.fktrace> [out.json]
+//        out.json defaults to the input path with a .json extension
+// =============================================================================
+
+#include <FrameKit/Debug/TraceFormat.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace FrameKit;
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        std::fprintf(stderr, "usage: TraceConvert <in.fktrace> [out.json]\n");
+        return 2;
+    }
+    const std::filesystem::path in = argv[1];
+    std::filesystem::path out = argc > 2 ? std::filesystem::path(argv[2]) : in;
+    if (argc == 2) out.replace_extension(".json");
+
+    CompactTraceReader reader;
+    if (!reader.Open(in)) {
+        std::fprintf(stderr, "TraceConvert: %s is not a readable compact trace\n", in.string().c_str());
+        return 1;
+    }
+
+    std::ofstream file(out, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!file) {
+        std::fprintf(stderr, "TraceConvert: cannot open %s\n", out.string().c_str());
+        return 1;
+    }
+
+    // Names live in the reader for its whole lifetime, so their address is a stable key
+    const auto writer = TraceWriter::Create(TraceFormat::ChromeJson);
+    std::string buf;
+    std::uint64_t events = 0;
+    TraceEvent e;
+    while (reader.Next(e)) {
+        if (events == 0) writer->Begin(buf, reader.Session());
+        writer->Write(buf, e, e.name.data());
+        ++events;
+        if (buf.size() >= (1u << 16)) {
+            file.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+            buf.clear();
+        }
+    }
+    if (events == 0) writer->Begin(buf, reader.Session());
+    writer->End(buf);
+    file.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+    file.close();
+    if (!file) {
+        std::fprintf(stderr, "TraceConvert: failed writing %s\n", out.string().c_str());
+        return 1;
+    }
+
+    if (reader.Truncated())
+        std::fprintf(stderr, "TraceConvert: %s ends in an incomplete record; converted what precedes it\n", in.string().c_str());
+    std::printf("%llu events -> %s\n", static_cast<unsigned long long>(events), out.string().c_str());
+    return 0;
+}
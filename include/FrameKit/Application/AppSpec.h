@@ -3,7 +3,7 @@
 // File         : include/FrameKit/Application/AppSpec.h
 // Author       : George Gil
 // Created      : 2025-09-07
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
 //      Defines application specifications, optional settings, and command line arguments.
@@ -14,6 +14,9 @@
 #include "FrameKit/Engine/Defines.h"
 #include "FrameKit/Window/IWindow.h"
 #include "FrameKit/Gfx/API/RendererConfig.h"
+#include "FrameKit/Debug/Log.h"
+#include "FrameKit/Debug/LogSink.h"
+#include "FrameKit/Debug/Instrumentor.h"
 #include <cstdint>
 #include <filesystem>
 #include <string>
@@ -40,6 +43,68 @@ namespace FrameKit {
         bool operator==(const WindowSettings&) const = default;
     };
 
+    // ---------- Job system settings ----------
+    struct JobSettings {
+        std::uint32_t workerCount{ 0 };          // 0 = hardware_concurrency() - 1
+        bool          asyncLayerUpdate{ true };  // run Layer::OnAsyncUpdate on a worker each frame
+
+        bool operator==(const JobSettings&) const = default;
+    };
+
+    // ---------- Run loop settings ----------
+    enum class IdlePolicy : unsigned {
+        Continuous = 0,     // run frames back to back (subject to maxFps)
+        WaitEvents = 1      // windowed only: block until input, RequestRedraw() or a timer
+    };
+
+    struct LoopSettings {
+        double        maxFps{ 0.0 };             // frame-rate cap; 0 = uncapped
+        std::uint32_t spinWindowUs{ 0 };         // pacer spin phase before each deadline; 0 = adaptive
+        double        fixedUpdateHz{ 0.0 };      // > 0 enables fixed-step OnFixedUpdate at this rate
+        std::uint32_t maxFixedSteps{ 8 };        // catch-up cap per frame; excess time is dropped
+        double        maxFrameDelta{ 0.25 };     // seconds; longer frames are clamped before accumulation
+
+        IdlePolicy    idlePolicy{ IdlePolicy::Continuous };
+        double        idleTimeout{ 0.0 };        // WaitEvents: force a frame after this many seconds; 0 = never
+        double        idleAsyncHz{ 10.0 };       // WaitEvents: OnAsyncUpdate rate while no frames run; 0 = frames only
+
+        bool operator==(const LoopSettings&) const = default;
+    };
+
+    // ---------- Event delivery settings ----------
+    struct EventSettings {
+        bool          deferred{ false };          // queue events; the host delivers them once per frame before OnUpdate
+        std::uint32_t arenaBytes{ 64 * 1024 };    // per-frame event arena (two are used); overflow goes to the heap
+        bool          coalesceMouseMove{ false }; // merge consecutive cursor updates into one MouseMovedEvent per run
+        bool          coalesceScroll{ false };    // merge consecutive wheel updates, summing the offsets
+        bool          mouseMoveHistory{ false };  // keep the raw positions of a coalesced move (MouseMovedEvent::GetHistory)
+        std::string   recordPath;                 // non-empty => record window input and frame deltas (EventRecorder)
+        std::string   replayPath;                 // non-empty => headless host replays this recording, unpaced
+
+        bool operator==(const EventSettings&) const = default;
+    };
+
+    // ---------- Logging settings ----------
+    struct LogSettings {
+        bool             async{ false };         // background writer thread for all loggers (Log::StartAsync)
+        AsyncLogSettings queue{};                // capacity and overflow policy
+        FileSinkSettings files{};                // buffering/rotation of FrameKit.log and <App>.log (path unused)
+        bool             sharedMemory{ false };  // also publish to "fk_shm_log_<pid>_<n>" for Tools/ShmLogViewer
+
+        bool operator==(const LogSettings&) const = default;
+    };
+
+    // ---------- Profiling settings ----------
+    struct ProfileSettings {
+        bool                   flightRecorder{ false };  // keep recent FK_PROFILE scopes in memory (Instrumentor::StartFlightRecorder)
+        FlightRecorderSettings recorder{};
+        double                 frameBudgetMs{ 0.0 };     // > 0: a frame slower than this requests a flight dump
+        bool                   scopeStats{ false };      // per-scope histograms and a periodic summary (Instrumentor::StartScopeStats)
+        ScopeStatsSettings     stats{};
+
+        bool operator==(const ProfileSettings&) const = default;
+    };
+
     // ---------- Command line args ----------
     struct ApplicationCommandLineArgs {
         int    Count = 0;
@@ -58,6 +123,11 @@ namespace FrameKit {
         AppMode                    Mode = AppMode::Windowed;
         WindowSettings             WinSettings = {};
         RendererConfig             GfxSettings = {};
+        JobSettings                Jobs = {};
+        LoopSettings               Loop = {};
+        EventSettings              Events = {};
+        LogSettings                Logging = {};
+        ProfileSettings            Profiling = {};
         bool                       Master = false;  // optional, for multi-instance apps or IPC roles
     };
 
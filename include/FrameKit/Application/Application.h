@@ -3,7 +3,7 @@
 // File         : include/FrameKit/Application/Application.h
 // Author       : George Gil
 // Created      : 2025-09-07
-// Updated      : 2025-09-08
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
 //      Defines the Application class for the FrameKit framework. Inherits from
@@ -16,12 +16,16 @@
 #include "FrameKit/Application/ApplicationBase.h"
 #include "FrameKit/Utilities/Time.h"
 
+#include <memory>
+
 namespace FrameKit {
+    class LayerGraph;
+
     class Application : public ApplicationBase {
     public:
-        Application() = default;
-        explicit Application(const ApplicationSpecification& spec) : ApplicationBase(spec) {}
-        ~Application() override = default;
+        Application();
+        explicit Application(const ApplicationSpecification& spec);
+        ~Application() override;
 
 		// Lifecycle - Can be implemented by the client application
         bool Init() override { return true; }
@@ -30,9 +34,11 @@ namespace FrameKit {
 		// sensible defaults; override as needed
 		// NOTE: override only if you need to customise the execution loop
 		// NOTE: Override only if you know what you are doing!
-		bool OnUpdate(Timestep /*ts*/) override;
+		bool OnUpdate(Timestep /*ts*/) override;	// layers that declare their accesses update in parallel
 		void OnRender() override;// only called in windowed mode
 		void OnEvent(Event& /*e*/) override;
+		void OnAsyncUpdate() override;	// forwards to Layer::OnAsyncUpdate
+		void OnFixedUpdate(Timestep /*fixedTs*/) override;	// forwards to Layer::OnFixedUpdate
 
 		// For more advanced usage, override these hooks as needed:
 		// void OnBeforePoll() override {}
@@ -43,6 +49,10 @@ namespace FrameKit {
 		// void OnAfterRender() override {}
 		// void OnFrameEnd() override {}
 		// void OnUnhandledEvent(Event& /*e*/) override {}
+
+	private:
+		std::unique_ptr<LayerGraph> m_UpdateGraph;
+
     };
 
     // Client must implement this to create their application instance.
@@ -3,7 +3,7 @@
 // File         : include/FrameKit/Application/ApplicationBase.h
 // Author       : George Gil
 // Created      : 2025-09-07
-// Updated      : 2025-09-08
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
 //      Defines the ApplicationBase class and related specifications for the
@@ -16,6 +16,8 @@
 #include "FrameKit/Application/AppSpec.h"
 #include "FrameKit/Utilities/Time.h"
 
+#include <atomic>
+#include <cstdint>
 #include <mutex>
 
 namespace FrameKit
@@ -58,16 +60,49 @@ namespace FrameKit
 		virtual void OnRender() {}										// only called in windowed mode
 		virtual void OnEvent(Event& /*e*/) {}							// executed after layers; mark handled to stop propagation
 		virtual void OnUnhandledEvent(Event& /*e*/) {}					// executed if event was unhandled by layers and app
+		virtual void OnAsyncUpdate() {}									// runs on a job worker, concurrently with the frame
+		virtual void OnFixedUpdate(Timestep /*fixedTs*/) {}				// fixed-step mode only; 0..N times per frame, before OnUpdate
+
+		// Fixed-step state for the current frame. Alpha is the fraction of a step
+		// left in the accumulator, in [0, 1); blend previous/current state with it
+		// in OnRender. Both stay 0 when fixed-step mode is off.
+		FK_NODISCARD float    GetInterpolationAlpha() const noexcept { return m_InterpolationAlpha; }
+		FK_NODISCARD Timestep GetFixedTimestep() const noexcept { return m_FixedTimestep; }
 
 		// --- Runtime layer management ---
+		// Safe from any thread. On the main thread the change takes effect at once
+		// (OnAttach() has run on return); from other threads it is staged and
+		// applied at the next frame boundary. Popped layers are detached and
+		// deleted once no in-flight pass still iterates over them.
 		void PushLayer(Layer* layer);
 		void PushOverlay(Layer* layer);
+		void PopLayer(Layer* layer);
+		void PopOverlay(Layer* layer);
+
+		// Called by the host at the start of every frame, on the main thread.
+		void SyncLayerStack();
+
+		// --- Idle mode (LoopSettings::idlePolicy == WaitEvents) ---
+		// Ask the windowed host for another frame, now or after `delay`. Safe from
+		// any thread; continuous animations call RequestRedraw() every frame.
+		// No-ops (frames run anyway) in Continuous mode.
+		void RequestRedraw() noexcept;
+		void RequestRedrawIn(Timestep delay) noexcept;
 
 	protected:
 		ApplicationSpecification	m_Specification;
 		LayerStack*					m_LayerStack = nullptr; 
-		std::mutex					m_LayerStackMutex;
 
 	private: 
+		friend struct CommonLoop;	// host loop publishes the fixed-step state and installs the waker
+
+		float						m_InterpolationAlpha = 0.0f;
+		Timestep					m_FixedTimestep{};
+
+		std::atomic<bool>			m_RedrawRequested{ false };
+		std::atomic<std::int64_t>	m_RedrawDeadlineNs{ INT64_MAX };	// steady_clock ticks (ns)
+		std::mutex					m_WakeMutex;
+		void						(*m_WakeFn)(void*) = nullptr;	// wakes the host from its idle wait
+		void*						m_WakeCtx = nullptr;
 	};
 }
\ No newline at end of file
@@ -3,22 +3,45 @@
 // File         : include/Debug/Instrumentor.h
 // Author       : George Gil
 // Created      : 2025-09-09
-// Updated      : 2025-09-09
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Defines a simple instrumentation system for profiling C++ code.
+//      Scopes append fixed-size binary records (name pointer, start, duration)
+//      to a per-thread chunked buffer; a background flusher turns them into
+//      the session format (Chrome trace JSON or the compact
+//      format in TraceFormat.h), so the hot path takes no lock and does no I/O.
+//      Besides scopes, records carry counters, instants, cross-thread flows
+//      and frame begin/end markers.
+//      Flight-recorder mode keeps only the most recent records per thread in
+//      fixed rings and writes them out on demand (API, opt-in SIGUSR2, slow frame).
+//      Scope statistics mode folds durations into per-thread histograms for
+//      always-on percentiles (see ScopeStats.h); it combines with either.
 // =============================================================================
 
 #pragma once
 
 #include "FrameKit/Engine/Defines.h"
+#include "FrameKit/Debug/ScopeStats.h"
+#include "FrameKit/Debug/TraceFormat.h"
 
+#include <atomic>
+#include <bit>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <fstream>
 #include <filesystem>
+#include <thread>
+
+// Trace timestamps come from the invariant TSC where we can read it directly
+#if (defined(_MSC_VER) && defined(_M_X64)) || ((defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__))
+#define FK_TRACE_TSC 1
+#else
+#define FK_TRACE_TSC 0
+#endif
 
 namespace FrameKit {
 
@@ -33,6 +56,17 @@ namespace FrameKit {
 
     struct InstrumentationSession { std::string Name; };
 
+    struct FlightRecorderSettings {
+        std::uint32_t recordsPerThread{ 1u << 16 };   // ring size per thread (24 bytes each), power of two
+        double        windowSeconds{ 10.0 };          // how far back a dump reaches
+        double        cooldownSeconds{ 5.0 };         // min gap between requested (non-forced) dumps
+        std::string   directory{ "." };               // dumps go to <directory>/flight_<unix ms>_<reason>.<json|fktrace>
+        TraceFormat   format{ TraceFormat::ChromeJson };
+        bool          dumpOnSignal{ false };          // SIGUSR2 requests a dump (POSIX only); replaces the app's handler
+
+        bool operator==(const FlightRecorderSettings&) const = default;
+    };
+
     class Instrumentor {
     public:
         Instrumentor(const Instrumentor&) = delete;
@@ -40,26 +74,130 @@ namespace FrameKit {
         Instrumentor(Instrumentor&&) = delete;
         Instrumentor& operator=(Instrumentor&&) = delete;
 
+        // Compact traces are ~10x smaller; Tools/TraceConvert turns them into JSON.
         void BeginSession(const std::string& name,
-            const std::filesystem::path& filepath = "results.json");
+            const std::filesystem::path& filepath = "results.json",
+            TraceFormat format = TraceFormat::ChromeJson);
         void EndSession();
+        // Writes one result directly (takes the session lock); scopes use Record().
         void WriteProfile(const ProfileResult& result);
 
+        // Flight recorder: ends any session and keeps the last records of each
+        // thread in memory instead of streaming them. recordsPerThread applies to
+        // threads that have not recorded in flight mode before. EndSession() stops it.
+        void StartFlightRecorder(const FlightRecorderSettings& settings = {});
+        FK_NODISCARD static bool IsFlightRecording() noexcept { return (s_Mode.load(std::memory_order_relaxed) & kModeFlight) != 0; }
+        // Writes the last window now, on the calling thread. Returns the file path, or empty on failure.
+        std::string DumpFlightRecorder(const std::string& reason = "manual");
+        // Asks the recorder thread to dump soon; cheap and safe from hot paths.
+        // Ignored while a dump is pending or within the cooldown of the last one.
+        void RequestFlightDump(const char* reason) noexcept;
+
+        // Scope statistics: per-scope histograms, independent of sessions and the
+        // flight recorder. Snapshots cover the time since StartScopeStats().
+        void StartScopeStats(const ScopeStatsSettings& settings = {});
+        void StopScopeStats();
+        FK_NODISCARD static bool IsCollectingStats() noexcept { return (s_Mode.load(std::memory_order_relaxed) & kModeStats) != 0; }
+        FK_NODISCARD ScopeStatsSnapshot SnapshotScopeStats();
+
+        // Hot path: appends to the calling thread's trace buffer. `name` must have
+        // static storage duration; it is read later by the flusher thread.
+        static void Record(const char* name, std::int64_t startTicks, std::int64_t endTicks) noexcept;
+        FK_NODISCARD static bool IsActive() noexcept { return s_Mode.load(std::memory_order_relaxed) != 0; }
+
+        // Non-scope events; no-ops unless a session or the flight recorder runs.
+        // Names need static storage duration, like scope names.
+        static void Counter(const char* name, double value) noexcept {
+            if (IsTracing()) Emit(TraceEventKind::Counter, name, NowTicks(), std::bit_cast<std::int64_t>(value));
+        }
+        static void Instant(const char* name) noexcept {
+            if (IsTracing()) Emit(TraceEventKind::Instant, name, NowTicks(), 0);
+        }
+        // Call inside a scope on each side; equal ids connect the two.
+        static void FlowBegin(const char* name, std::uint64_t id) noexcept {
+            if (IsTracing()) Emit(TraceEventKind::FlowBegin, name, NowTicks(), static_cast<std::int64_t>(id));
+        }
+        static void FlowEnd(const char* name, std::uint64_t id) noexcept {
+            if (IsTracing()) Emit(TraceEventKind::FlowEnd, name, NowTicks(), static_cast<std::int64_t>(id));
+        }
+        // Host frame boundaries. FrameEnd also counts frames for scope statistics.
+        static void FrameBegin(std::uint64_t frame) noexcept {
+            if (IsTracing()) Emit(TraceEventKind::FrameBegin, "Frame", NowTicks(), static_cast<std::int64_t>(frame));
+        }
+        static void FrameEnd(std::uint64_t frame) noexcept {
+            s_Frames.fetch_add(1, std::memory_order_relaxed);
+            if (IsTracing()) Emit(TraceEventKind::FrameEnd, "Frame", NowTicks(), static_cast<std::int64_t>(frame));
+        }
+
+        FK_NODISCARD static std::int64_t NowNs() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+        // Trace timestamp: the invariant TSC on x86-64 (a few ns to read),
+        // steady_clock nanoseconds elsewhere. The flusher converts to time.
+        FK_NODISCARD static std::int64_t NowTicks() noexcept {
+#if FK_TRACE_TSC && defined(_MSC_VER)
+            return static_cast<std::int64_t>(__rdtsc());
+#elif FK_TRACE_TSC
+            return static_cast<std::int64_t>(__builtin_ia32_rdtsc());
+#else
+            return NowNs();
+#endif
+        }
+
         static Instrumentor& Get() noexcept;
 
     private:
-        Instrumentor() = default;
+        Instrumentor() : m_CalTicks(NowTicks()), m_CalNs(NowNs()) {}
         ~Instrumentor();  // defined in .cpp
 
-        void WriteHeader();
-        void WriteFooter();
+        FK_NODISCARD static bool IsTracing() noexcept {
+            return (s_Mode.load(std::memory_order_relaxed) & (kModeStream | kModeFlight)) != 0;
+        }
+        static void Emit(TraceEventKind kind, const char* name, std::int64_t ticks, std::int64_t value) noexcept;
+
+        void WriteScratch();                 // m_Scratch -> file; pre: mutex held
         void InternalEndSession();           // pre: mutex held
-        static std::string EscapeForJson(const std::string& s);
+        void StartFlusher();                 // no-op if it is running
+        void StopFlusher();                  // pre: mutex not held
+        void FlusherMain();
+        void DrainBuffers(bool write);       // pre: mutex held
+        std::string WriteFlightDump(const std::string& reason);   // pre: mutex held
+        void PruneRetired(bool all);         // pre: mutex held
+        ScopeStatsSnapshot CollectScopeStats();   // pre: mutex held; cumulative since process start
+        void ReportScopeStats();             // pre: mutex held
+        double NsPerTick();                  // calibrated since construction
 
     private:
+        static constexpr std::uint32_t kModeStream = 1;   // BeginSession
+        static constexpr std::uint32_t kModeFlight = 2;   // StartFlightRecorder (excludes kModeStream)
+        static constexpr std::uint32_t kModeStats = 4;    // StartScopeStats
+        static inline std::atomic<std::uint32_t> s_Mode{ 0 };
+        static inline std::atomic<std::uint64_t> s_Frames{ 0 };
+
         std::mutex m_Mutex;
         std::unique_ptr<InstrumentationSession> m_CurrentSession;
         std::ofstream m_OutputStream;
+        std::unique_ptr<TraceWriter> m_Writer;
+        std::string m_Scratch;               // serialized events, reused between drains
+        std::int64_t m_BaseTicks = 0;        // session start, for tick -> ns conversion
+        std::int64_t m_BaseNs = 0;
+        std::int64_t m_CalTicks = 0;         // tick rate calibration anchor
+        std::int64_t m_CalNs = 0;
+
+        std::thread m_Flusher;
+        std::mutex m_FlushMutex;
+        std::condition_variable m_FlushCv;
+        bool m_StopFlusher = false;          // guarded by m_FlushMutex
+        const char* m_DumpReason = nullptr;  // guarded by m_FlushMutex
+
+        FlightRecorderSettings m_Flight;
+        std::int64_t m_LastDumpNs = 0;       // guarded by m_FlushMutex
+        std::int64_t m_DumpCooldownNs = 0;   // guarded by m_FlushMutex
+
+        ScopeStatsSettings m_Stats;
+        ScopeStatsSnapshot m_StatsBaseline;  // at StartScopeStats
+        ScopeStatsSnapshot m_StatsReported;  // at the last periodic report
     };
 
     class InstrumentationTimer {
@@ -71,7 +209,7 @@ namespace FrameKit {
 
     private:
         const char* m_Name;
-        std::chrono::time_point<std::chrono::steady_clock> m_StartTimepoint;
+        std::int64_t m_StartTicks;
         bool m_Stopped;
     };
 
@@ -120,14 +258,26 @@ namespace FrameKit {
 #  define FK_PROFILE_END_SESSION() \
        ::FrameKit::Instrumentor::Get().EndSession()
 #  define FK_PROFILE_SCOPE_LINE2(name, line) \
-       constexpr auto fixedName##line = ::FrameKit::InstrumentorUtils::CleanFunctionSig(name); \
+       static constexpr auto fixedName##line = ::FrameKit::InstrumentorUtils::CleanFunctionSig(name); \
        ::FrameKit::InstrumentationTimer timer##line(fixedName##line.Data)
 #  define FK_PROFILE_SCOPE_LINE(name, line) FK_PROFILE_SCOPE_LINE2(name, line)
 #  define FK_PROFILE_SCOPE(name)            FK_PROFILE_SCOPE_LINE(name, __LINE__)
 #  define FK_PROFILE_FUNCTION()             FK_PROFILE_SCOPE(FK_FUNC_SIG)
+#  define FK_PROFILE_COUNTER(name, value)   ::FrameKit::Instrumentor::Counter(name, static_cast<double>(value))
+#  define FK_PROFILE_INSTANT(name)          ::FrameKit::Instrumentor::Instant(name)
+#  define FK_PROFILE_FLOW_BEGIN(name, id)   ::FrameKit::Instrumentor::FlowBegin(name, id)
+#  define FK_PROFILE_FLOW_END(name, id)     ::FrameKit::Instrumentor::FlowEnd(name, id)
+#  define FK_PROFILE_FRAME_BEGIN(frame)     ::FrameKit::Instrumentor::FrameBegin(frame)
+#  define FK_PROFILE_FRAME_END(frame)       ::FrameKit::Instrumentor::FrameEnd(frame)
 #else
 #  define FK_PROFILE_BEGIN_SESSION(name, filepath)
 #  define FK_PROFILE_END_SESSION()
 #  define FK_PROFILE_SCOPE(name)
 #  define FK_PROFILE_FUNCTION()
+#  define FK_PROFILE_COUNTER(name, value)
+#  define FK_PROFILE_INSTANT(name)
+#  define FK_PROFILE_FLOW_BEGIN(name, id)
+#  define FK_PROFILE_FLOW_END(name, id)
+#  define FK_PROFILE_FRAME_BEGIN(frame)
+#  define FK_PROFILE_FRAME_END(frame)
 #endif
@@ -3,22 +3,29 @@
 // File         : include/FrameKit/Debug/Log.h 
 // Author       : George Gil
 // Created      : 2025-09-09
-// Updated      : 2025-09-09
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
-//      Thread-safe logging with console/file sinks, levels, and '{}' formatting.
+//      Thread-safe logging with pluggable sinks (LogSink.h), levels, and '{}'
+//      formatting.
+//      The FK_* macros parse the format string at compile time and only copy
+//      argument bytes (LogFormat.h). In async mode that record goes into a
+//      bounded queue and a background thread formats it, adds the prefix and
+//      colors and does the I/O in batches.
+//      Levels are filtered twice: FK_LOG_ACTIVE_LEVEL removes whole levels at
+//      compile time, and each LogModule has a runtime level checked with one
+//      relaxed load before any argument is evaluated.
 // =============================================================================
 
 #pragma once
 
 #include "FrameKit/Engine/Defines.h"
 #include "FrameKit/Utilities/Memory.h"
-#include "FrameKit/Debug/Log.h"
+#include "FrameKit/Debug/LogFormat.h"
 
 #include <atomic>
 #include <chrono>
 #include <cstdint>
-#include <fstream>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -29,7 +36,59 @@ namespace FrameKit {
 
     enum class LogLevel : std::uint8_t { Trace, Info, Warn, Error, Critical, Off };
 
+    class LogSink;
+    struct FileSinkSettings;
+
+    // Runtime filter groups. Core and Client follow their logger's level; the
+    // named modules write through the core logger, tagged "FrameKit/<Module>",
+    // so they also need the core logger's level. Named modules start at Trace
+    // in debug builds, leaving the core logger as the only filter, and at Info
+    // otherwise.
+    enum class LogModule : std::uint8_t { Core, Client, Host, Window, Events, Jobs, Addon, SHM, Count };
+
+    // What a full async queue does with a new record
+    enum class LogOverflow : std::uint8_t {
+        Block,       // wait for the writer thread (nothing is lost)
+        Drop,        // discard the new record
+        DropOldest   // discard the oldest queued record
+    };
+
+    struct AsyncLogSettings {
+        std::uint32_t capacity{ 8192 };              // records, rounded up to a power of two
+        LogOverflow   overflow{ LogOverflow::Block };
+
+        bool operator==(const AsyncLogSettings&) const = default;
+    };
+
     namespace detail {
+        inline constexpr std::size_t kLogModuleCount = static_cast<std::size_t>(LogModule::Count);
+
+        inline constexpr LogLevel kLogModuleDefault = FK_DEBUG ? LogLevel::Trace : LogLevel::Info;
+
+        inline std::atomic<LogLevel> g_LogModuleLevels[kLogModuleCount] = {
+            LogLevel::Off, LogLevel::Off,                                  // Core, Client (mirror the bound loggers)
+            kLogModuleDefault, kLogModuleDefault, kLogModuleDefault,       // Host, Window, Events
+            kLogModuleDefault, kLogModuleDefault, kLogModuleDefault        // Jobs, Addon, SHM
+        };
+
+        FK_FORCE_INLINE bool LogEnabled(LogModule m, LogLevel lvl) noexcept {
+            return lvl >= g_LogModuleLevels[static_cast<std::size_t>(m)].load(std::memory_order_relaxed);
+        }
+
+        inline const char* module_to_cstr(LogModule m) {
+            switch (m) {
+            case LogModule::Core:   return "Core";
+            case LogModule::Client: return "Client";
+            case LogModule::Host:   return "Host";
+            case LogModule::Window: return "Window";
+            case LogModule::Events: return "Events";
+            case LogModule::Jobs:   return "Jobs";
+            case LogModule::Addon:  return "Addon";
+            case LogModule::SHM:    return "SHM";
+            default:                return "?";
+            }
+        }
+
         template<typename... Args>
         inline std::string vformat(std::string_view fmt, Args&&... args) {
             std::ostringstream oss;
@@ -84,20 +143,48 @@ namespace FrameKit {
     public:
         explicit Logger(std::string name) : m_Name(std::move(name)) {}
 
-        void set_level(LogLevel lvl) { m_Level.store(lvl, std::memory_order_relaxed); }
+        void set_level(LogLevel lvl) {
+            m_Level.store(lvl, std::memory_order_relaxed);
+            if (m_Module != LogModule::Count)
+                detail::g_LogModuleLevels[static_cast<std::size_t>(m_Module)].store(lvl, std::memory_order_relaxed);
+        }
         LogLevel level() const { return m_Level.load(std::memory_order_relaxed); }
 
+        // Default sinks: one console and one file sink per logger
         void set_file(const std::string& path, bool append = true);
-        void enable_console(bool on) { m_Console.store(on, std::memory_order_relaxed); }
+        void set_file(const FileSinkSettings& settings);   // empty path removes the file sink
+        void enable_console(bool on);
+
+        // Additional sinks; each line goes to every attached sink
+        void add_sink(Ref<LogSink> sink);
+        void remove_sink(const Ref<LogSink>& sink);
+
+        FK_NODISCARD bool should_log(LogLevel lvl) const noexcept {
+            const auto cur = m_Level.load(std::memory_order_relaxed);
+            return cur != LogLevel::Off && lvl >= cur;
+        }
 
+        // Runtime format string: formatted on the calling thread
         template<typename... Args>
         void log(LogLevel lvl, std::string_view fmt, Args&&... args) noexcept {
-            const auto cur = m_Level.load(std::memory_order_relaxed);
-            if (cur == LogLevel::Off || lvl < cur) return;
+            if (!should_log(lvl)) return;
             const auto msg = detail::vformat(fmt, std::forward<Args>(args)...);
             write_line(lvl, msg);
         }
 
+        // Compile-time format (FK_* macros): arguments are captured as bytes and
+        // formatted by the writer thread in async mode. The caller checks the
+        // module level; `module` tags the line when it is not the logger's own.
+        // The logger's level applies on top, so a module cannot log below it.
+        template<typename... Args>
+        void log_spec(LogLevel lvl, LogModule module, const detail::FormatSpec& spec, const Args&... args) noexcept {
+            if (!should_log(lvl)) return; // also covers no-op and torn-down loggers
+            static constexpr std::array<detail::LogArg, sizeof...(Args)> kinds{ detail::ArgKindOf<Args>()... };
+            detail::ArgBuffer buf;
+            (buf.Put(args), ...);
+            write_binary(lvl, module, spec, kinds.data(), kinds.size(), buf.data(), buf.size());
+        }
+
         template<typename... Args> void trace(std::string_view f, Args&&... a) { log(LogLevel::Trace, f, std::forward<Args>(a)...); }
         template<typename... Args> void info(std::string_view f, Args&&... a) { log(LogLevel::Info, f, std::forward<Args>(a)...); }
         template<typename... Args> void warn(std::string_view f, Args&&... a) { log(LogLevel::Warn, f, std::forward<Args>(a)...); }
@@ -105,13 +192,26 @@ namespace FrameKit {
         template<typename... Args> void critical(std::string_view f, Args&&... a) { log(LogLevel::Critical, f, std::forward<Args>(a)...); }
 
     private:
-        static std::string now_hms() noexcept;
+        friend class LogBackend;
+        friend class Log;
+
+        static std::string format_hms(std::int64_t unixNs) noexcept;
+        static std::int64_t now_ns() noexcept;
         void write_line(LogLevel lvl, const std::string& message) noexcept;
+        void write_binary(LogLevel lvl, LogModule module, const detail::FormatSpec& spec, const detail::LogArg* kinds,
+                          std::size_t argc, const std::byte* data, std::size_t size) noexcept;
+        // Formats and writes one line without flushing; callers hold no lock.
+        void write_record(LogLevel lvl, LogModule module, std::int64_t unixNs, std::string_view message) noexcept;
+        void bind_module(LogModule m) { m_Module = m; set_level(level()); }
+        void commit_sinks() noexcept;   // end of line/batch: sinks write out what is due
+        void flush_sinks() noexcept;    // everything to the OS
 
         std::string              m_Name;
         std::atomic<LogLevel>    m_Level{ LogLevel::Trace };
-        std::atomic<bool>        m_Console{ true };
-        std::ofstream            m_File;
+        LogModule                m_Module = LogModule::Count;   // module slot mirrored by set_level
+        std::vector<Ref<LogSink>> m_Sinks;
+        Ref<LogSink>             m_ConsoleSink;
+        Ref<LogSink>             m_FileSink;
         std::mutex               m_Mutex;
     };
 
@@ -127,8 +227,30 @@ namespace FrameKit {
         static Ref<Logger>& GetCoreLogger();
         static Ref<Logger>& GetClientLogger();
 
+        // Async mode: starts the writer thread; later calls reconfigure nothing.
+        static void StartAsync(const AsyncLogSettings& settings = {});
+        // Writes everything queued, joins the writer thread and returns to synchronous logging.
+        static void StopAsync();
+        FK_NODISCARD static bool IsAsync() noexcept;
+        // Blocks until every record queued before the call has been written and
+        // the sinks are flushed. Use on crash/exit paths. No-op when synchronous.
+        static void Flush();
+        FK_NODISCARD static std::uint64_t DroppedCount() noexcept;
+
+        // Runtime filter per module (Core/Client forward to their logger)
+        static void SetModuleLevel(LogModule module, LogLevel level);
+        FK_NODISCARD static LogLevel GetModuleLevel(LogModule module) noexcept;
+
+        // Buffering/rotation policy for the default "<name>.log" file sinks.
+        // `path` is ignored; applies to the current loggers and later ones.
+        static void SetFileSettings(const FileSinkSettings& settings);
+
     private:
+        friend class LogBackend;
+
         static Ref<Logger>& Noop();
+        // Writer thread idle tick: lets sinks honor their flush interval
+        static void CommitSinks() noexcept;
 
         static std::mutex  s_Mutex;
         static Ref<Logger> s_CoreLogger;
@@ -137,14 +259,86 @@ namespace FrameKit {
 
 } // namespace FrameKit
 
-// Core log macros
-#define FK_CORE_TRACE(...)    ::FrameKit::Log::GetCoreLogger()->trace(__VA_ARGS__)
-#define FK_CORE_INFO(...)     ::FrameKit::Log::GetCoreLogger()->info(__VA_ARGS__)
-#define FK_CORE_WARN(...)     ::FrameKit::Log::GetCoreLogger()->warn(__VA_ARGS__)
-#define FK_CORE_ERROR(...)    ::FrameKit::Log::GetCoreLogger()->error(__VA_ARGS__)
-#define FK_CORE_CRITICAL(...) ::FrameKit::Log::GetCoreLogger()->critical(__VA_ARGS__)
-#define FK_TRACE(...)         ::FrameKit::Log::GetClientLogger()->trace(__VA_ARGS__)
-#define FK_INFO(...)          ::FrameKit::Log::GetClientLogger()->info(__VA_ARGS__)
-#define FK_WARN(...)          ::FrameKit::Log::GetClientLogger()->warn(__VA_ARGS__)
-#define FK_ERROR(...)         ::FrameKit::Log::GetClientLogger()->error(__VA_ARGS__)
-#define FK_CRITICAL(...)      ::FrameKit::Log::GetClientLogger()->critical(__VA_ARGS__)
+// ---------------- Macros ----------------
+// FK_LOG_ACTIVE_LEVEL: lowest level compiled in (0=Trace, 1=Info, 2=Warn,
+// 3=Error, 4=Critical, 5=Off). Calls below it are discarded at compile time;
+// their arguments are still type-checked but never evaluated.
+#define FK_LOG_LEVEL_TRACE    0
+#define FK_LOG_LEVEL_INFO     1
+#define FK_LOG_LEVEL_WARN     2
+#define FK_LOG_LEVEL_ERROR    3
+#define FK_LOG_LEVEL_CRITICAL 4
+#define FK_LOG_LEVEL_OFF      5
+
+#if !defined(FK_LOG_ACTIVE_LEVEL)
+#if FK_DEBUG
+#define FK_LOG_ACTIVE_LEVEL FK_LOG_LEVEL_TRACE
+#else
+#define FK_LOG_ACTIVE_LEVEL FK_LOG_LEVEL_INFO
+#endif
+#endif
+
+// Parses `fmt` (a string literal) once at compile time; the logger is looked
+// up and arguments are evaluated only when the module level is enabled.
+#define FK_LOG_AT_(module, logger, lvl, fmt, ...)                                                     \
+    do {                                                                                              \
+        if (::FrameKit::detail::LogEnabled(module, lvl)) {                                            \
+            static constexpr auto fk_parsed_ =                                                        \
+                ::FrameKit::detail::ParseFormat<::FrameKit::detail::CountSegments(fmt)>(fmt);         \
+            static constexpr ::FrameKit::detail::FormatSpec fk_spec_{                                 \
+                fmt, fk_parsed_.segments.data(), static_cast<std::uint16_t>(fk_parsed_.segments.size()), \
+                fk_parsed_.placeholders };                                                            \
+            (logger)->log_spec(lvl, module, fk_spec_, ##__VA_ARGS__);                                 \
+        }                                                                                             \
+    } while (0)
+
+#define FK_LOG_OFF_(module, logger, lvl, fmt, ...) \
+    do { if constexpr (false) { FK_LOG_AT_(module, logger, lvl, fmt, ##__VA_ARGS__); } } while (0)
+
+#define FK_CORE_LOGGER_   ::FrameKit::Log::GetCoreLogger()
+#define FK_CLIENT_LOGGER_ ::FrameKit::Log::GetClientLogger()
+
+#if FK_LOG_ACTIVE_LEVEL <= FK_LOG_LEVEL_TRACE
+#define FK_LOG_TRACE_ FK_LOG_AT_
+#else
+#define FK_LOG_TRACE_ FK_LOG_OFF_
+#endif
+#define FK_CORE_TRACE(fmt, ...)           FK_LOG_TRACE_(::FrameKit::LogModule::Core, FK_CORE_LOGGER_, ::FrameKit::LogLevel::Trace, fmt, ##__VA_ARGS__)
+#define FK_TRACE(fmt, ...)                FK_LOG_TRACE_(::FrameKit::LogModule::Client, FK_CLIENT_LOGGER_, ::FrameKit::LogLevel::Trace, fmt, ##__VA_ARGS__)
+#define FK_LOG_TRACE(module, fmt, ...)    FK_LOG_TRACE_(::FrameKit::LogModule::module, FK_CORE_LOGGER_, ::FrameKit::LogLevel::Trace, fmt, ##__VA_ARGS__)
+
+#if FK_LOG_ACTIVE_LEVEL <= FK_LOG_LEVEL_INFO
+#define FK_LOG_INFO_ FK_LOG_AT_
+#else
+#define FK_LOG_INFO_ FK_LOG_OFF_
+#endif
+#define FK_CORE_INFO(fmt, ...)            FK_LOG_INFO_(::FrameKit::LogModule::Core, FK_CORE_LOGGER_, ::FrameKit::LogLevel::Info, fmt, ##__VA_ARGS__)
+#define FK_INFO(fmt, ...)                 FK_LOG_INFO_(::FrameKit::LogModule::Client, FK_CLIENT_LOGGER_, ::FrameKit::LogLevel::Info, fmt, ##__VA_ARGS__)
+#define FK_LOG_INFO(module, fmt, ...)     FK_LOG_INFO_(::FrameKit::LogModule::module, FK_CORE_LOGGER_, ::FrameKit::LogLevel::Info, fmt, ##__VA_ARGS__)
+
+#if FK_LOG_ACTIVE_LEVEL <= FK_LOG_LEVEL_WARN
+#define FK_LOG_WARN_ FK_LOG_AT_
+#else
+#define FK_LOG_WARN_ FK_LOG_OFF_
+#endif
+#define FK_CORE_WARN(fmt, ...)            FK_LOG_WARN_(::FrameKit::LogModule::Core, FK_CORE_LOGGER_, ::FrameKit::LogLevel::Warn, fmt, ##__VA_ARGS__)
+#define FK_WARN(fmt, ...)                 FK_LOG_WARN_(::FrameKit::LogModule::Client, FK_CLIENT_LOGGER_, ::FrameKit::LogLevel::Warn, fmt, ##__VA_ARGS__)
+#define FK_LOG_WARN(module, fmt, ...)     FK_LOG_WARN_(::FrameKit::LogModule::module, FK_CORE_LOGGER_, ::FrameKit::LogLevel::Warn, fmt, ##__VA_ARGS__)
+
+#if FK_LOG_ACTIVE_LEVEL <= FK_LOG_LEVEL_ERROR
+#define FK_LOG_ERROR_ FK_LOG_AT_
+#else
+#define FK_LOG_ERROR_ FK_LOG_OFF_
+#endif
+#define FK_CORE_ERROR(fmt, ...)           FK_LOG_ERROR_(::FrameKit::LogModule::Core, FK_CORE_LOGGER_, ::FrameKit::LogLevel::Error, fmt, ##__VA_ARGS__)
+#define FK_ERROR(fmt, ...)                FK_LOG_ERROR_(::FrameKit::LogModule::Client, FK_CLIENT_LOGGER_, ::FrameKit::LogLevel::Error, fmt, ##__VA_ARGS__)
+#define FK_LOG_ERROR(module, fmt, ...)    FK_LOG_ERROR_(::FrameKit::LogModule::module, FK_CORE_LOGGER_, ::FrameKit::LogLevel::Error, fmt, ##__VA_ARGS__)
+
+#if FK_LOG_ACTIVE_LEVEL <= FK_LOG_LEVEL_CRITICAL
+#define FK_LOG_CRITICAL_ FK_LOG_AT_
+#else
+#define FK_LOG_CRITICAL_ FK_LOG_OFF_
+#endif
+#define FK_CORE_CRITICAL(fmt, ...)        FK_LOG_CRITICAL_(::FrameKit::LogModule::Core, FK_CORE_LOGGER_, ::FrameKit::LogLevel::Critical, fmt, ##__VA_ARGS__)
+#define FK_CRITICAL(fmt, ...)             FK_LOG_CRITICAL_(::FrameKit::LogModule::Client, FK_CLIENT_LOGGER_, ::FrameKit::LogLevel::Critical, fmt, ##__VA_ARGS__)
+#define FK_LOG_CRITICAL(module, fmt, ...) FK_LOG_CRITICAL_(::FrameKit::LogModule::module, FK_CORE_LOGGER_, ::FrameKit::LogLevel::Critical, fmt, ##__VA_ARGS__)
@@ -0,0 +1,180 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/Debug/LogFormat.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Deferred log formatting. The FK_* log macros parse their '{}' format
+//      string at compile time into a static FormatSpec; the call site only
+//      copies the raw argument bytes. FormatLogArgs() turns spec + bytes back
+//      into text, on the writer thread or in an offline decoder.
+// =============================================================================
+
+#pragma once
+
+#include "FrameKit/Engine/Defines.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace FrameKit::detail {
+
+    // ---- Compile-time format descriptor ----
+
+    struct FormatSegment {
+        static constexpr std::uint16_t kArg = 0xFFFF;
+        std::uint16_t offset = 0;
+        std::uint16_t length = 0;   // kArg => substitute the next argument
+    };
+
+    struct FormatSpec {
+        const char*          fmt = nullptr;
+        const FormatSegment* segments = nullptr;
+        std::uint16_t        count = 0;
+        std::uint16_t        placeholders = 0;
+    };
+
+    // Same grammar as vformat: "{}" is a placeholder, "{{" and "}}" are escapes.
+    template<typename Emit>
+    constexpr std::size_t ScanFormat(std::string_view f, Emit&& emit) {
+        std::size_t n = 0, start = 0, i = 0;
+        auto literal = [&](std::size_t end) {
+            if (end > start) { emit(FormatSegment{ static_cast<std::uint16_t>(start), static_cast<std::uint16_t>(end - start) }); ++n; }
+        };
+        while (i < f.size()) {
+            if (f[i] == '{' && i + 1 < f.size() && f[i + 1] == '}') {
+                literal(i);
+                emit(FormatSegment{ 0, FormatSegment::kArg }); ++n;
+                i += 2; start = i;
+            }
+            else if ((f[i] == '{' || f[i] == '}') && i + 1 < f.size() && f[i + 1] == f[i]) {
+                literal(i + 1);   // keep one brace
+                i += 2; start = i;
+            }
+            else {
+                ++i;
+            }
+        }
+        literal(f.size());
+        return n;
+    }
+
+    consteval std::size_t CountSegments(std::string_view f) {
+        return ScanFormat(f, [](FormatSegment) {});
+    }
+
+    template<std::size_t N>
+    struct ParsedFormat {
+        std::array<FormatSegment, N> segments{};
+        std::uint16_t                placeholders = 0;
+    };
+
+    template<std::size_t N>
+    consteval ParsedFormat<N> ParseFormat(std::string_view f) {
+        ParsedFormat<N> p{};
+        std::size_t i = 0;
+        ScanFormat(f, [&](FormatSegment s) {
+            if (s.length == FormatSegment::kArg) ++p.placeholders;
+            p.segments[i++] = s;
+        });
+        return p;
+    }
+
+    // ---- Argument encoding ----
+
+    enum class LogArg : std::uint8_t { Bool, Char, Int, UInt, Double, Pointer, String };
+
+    template<typename T>
+    constexpr LogArg ArgKindOf() {
+        using U = std::remove_cvref_t<T>;
+        if constexpr (std::is_same_v<U, bool>)                              return LogArg::Bool;
+        else if constexpr (std::is_same_v<U, char> || std::is_same_v<U, signed char> || std::is_same_v<U, unsigned char>)
+                                                                            return LogArg::Char;   // streams print these as characters
+        else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)    return LogArg::Int;
+        else if constexpr (std::is_integral_v<U>)                           return LogArg::UInt;
+        else if constexpr (std::is_floating_point_v<U>)                     return LogArg::Double;
+        else if constexpr (std::is_convertible_v<const U&, std::string_view>) return LogArg::String;
+        else if constexpr (std::is_pointer_v<U> || std::is_null_pointer_v<U>) return LogArg::Pointer;
+        else                                                                return LogArg::String; // streamed at the call site
+    }
+
+    // Argument bytes: small inline buffer, heap beyond that
+    class ArgBuffer {
+    public:
+        ArgBuffer() noexcept = default;
+        ArgBuffer(const ArgBuffer&) = delete;
+        ArgBuffer& operator=(const ArgBuffer&) = delete;
+
+        FK_NODISCARD const std::byte* data() const noexcept { return m_Heap ? m_Heap.get() : m_Inline; }
+        FK_NODISCARD std::size_t size() const noexcept { return m_Size; }
+
+        template<typename T>
+        void Put(const T& v) {
+            using U = std::remove_cvref_t<T>;
+            constexpr LogArg kind = ArgKindOf<T>();
+            if constexpr (kind == LogArg::Bool)         PutRaw<std::uint8_t>(v ? 1 : 0);
+            else if constexpr (kind == LogArg::Char)    PutRaw<char>(static_cast<char>(v));
+            else if constexpr (kind == LogArg::Int)     PutRaw<std::int64_t>(static_cast<std::int64_t>(v));
+            else if constexpr (kind == LogArg::UInt)    PutRaw<std::uint64_t>(static_cast<std::uint64_t>(v));
+            else if constexpr (kind == LogArg::Double)  PutRaw<double>(static_cast<double>(v));
+            else if constexpr (kind == LogArg::Pointer) PutRaw<std::uintptr_t>(reinterpret_cast<std::uintptr_t>(static_cast<const void*>(v)));
+            else if constexpr (std::is_convertible_v<const U&, std::string_view>) {
+                if constexpr (std::is_pointer_v<std::decay_t<U>>) {
+                    if (!v) { PutString("(null)"); return; }
+                }
+                PutString(std::string_view(v));
+            }
+            else {
+                std::ostringstream oss;
+                oss << v;
+                PutString(oss.str());
+            }
+        }
+
+    private:
+        template<typename R>
+        void PutRaw(R v) { std::memcpy(Grow(sizeof(R)), &v, sizeof(R)); }
+
+        void PutString(std::string_view s) {
+            const auto len = static_cast<std::uint32_t>(s.size());
+            std::byte* p = Grow(sizeof(len) + len);
+            std::memcpy(p, &len, sizeof(len));
+            if (len) std::memcpy(p + sizeof(len), s.data(), len);
+        }
+
+        std::byte* Grow(std::size_t n) {
+            const std::size_t cap = m_Heap ? m_Cap : sizeof(m_Inline);
+            if (m_Size + n > cap) {
+                const std::size_t newCap = std::max(cap * 2, m_Size + n);
+                auto heap = std::make_unique<std::byte[]>(newCap);
+                std::memcpy(heap.get(), data(), m_Size);
+                m_Heap = std::move(heap);
+                m_Cap = newCap;
+            }
+            std::byte* p = (m_Heap ? m_Heap.get() : m_Inline) + m_Size;
+            m_Size += n;
+            return p;
+        }
+
+        std::byte                    m_Inline[192];
+        std::unique_ptr<std::byte[]> m_Heap;
+        std::size_t                  m_Size = 0;
+        std::size_t                  m_Cap = 0;
+    };
+
+    // Appends the formatted message to `out`. Missing arguments print as "{}",
+    // extra ones are ignored (same as vformat).
+    void FormatLogArgs(std::string& out, const FormatSpec& spec, const LogArg* kinds, std::size_t argc,
+                       const std::byte* data, std::size_t size);
+
+} // namespace FrameKit::detail
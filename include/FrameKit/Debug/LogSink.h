@@ -0,0 +1,97 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/Debug/LogSink.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Log sinks. A Logger owns any number of sinks and hands each finished
+//      line to all of them. FileSink buffers lines in memory and writes them
+//      in large chunks, rotating by size and/or age with a retention count.
+// =============================================================================
+
+#pragma once
+
+#include "FrameKit/Debug/Log.h"
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace FrameKit {
+
+    class LogSink {
+    public:
+        virtual ~LogSink() = default;
+
+        // One formatted line without the trailing newline.
+        virtual void Write(LogLevel level, std::int64_t unixNs, std::string_view line) = 0;
+        // End of a line (sync) or of a batch (async): write out whatever the
+        // sink's policy says is due. Also called while the writer thread idles.
+        virtual void Commit() {}
+        // Hand everything to the OS now (Log::Flush, shutdown).
+        virtual void Flush() = 0;
+    };
+
+    // stdout with ANSI level colors
+    class ConsoleSink final : public LogSink {
+    public:
+        ConsoleSink();
+
+        void Write(LogLevel level, std::int64_t unixNs, std::string_view line) override;
+        void Commit() override { Flush(); }
+        void Flush() override;
+    };
+
+    struct FileSinkSettings {
+        std::string   path;
+        bool          append{ true };
+        std::uint32_t bufferBytes{ 64 * 1024 };        // drained with a single write when full
+        std::uint32_t flushIntervalMs{ 1000 };         // max age of buffered lines at Commit()
+        LogLevel      flushLevel{ LogLevel::Warn };    // lines at or above this are written at once
+        std::uint64_t maxBytes{ 32ull << 20 };         // rotate before the file would exceed this (0 = never)
+        std::uint32_t rotateIntervalSec{ 0 };          // rotate this long after the sink opened the file (0 = never);
+                                                       // an appended file's age from earlier runs is not counted
+        std::uint32_t maxFiles{ 5 };                   // rotated files kept: <stem>.1<ext> (newest) .. <stem>.N<ext>
+
+        bool operator==(const FileSinkSettings&) const = default;
+    };
+
+    class FileSink final : public LogSink {
+    public:
+        explicit FileSink(FileSinkSettings settings);
+        ~FileSink() override;
+
+        FileSink(const FileSink&) = delete;
+        FileSink& operator=(const FileSink&) = delete;
+
+        void Write(LogLevel level, std::int64_t unixNs, std::string_view line) override;
+        void Commit() override;
+        void Flush() override;
+
+        // Closes the current file, shifts the retained ones and starts a new file.
+        void Rotate();
+
+        FK_NODISCARD const FileSinkSettings& Settings() const noexcept { return m_Settings; }
+        FK_NODISCARD bool IsOpen() const noexcept { return m_File.is_open(); }
+
+    private:
+        void Open(bool append);
+        void Drain();      // buffer -> file, caller holds m_Mutex
+        void RotateLocked();
+        static std::string RotatedPath(const std::string& path, std::uint32_t index);
+
+        FileSinkSettings m_Settings;
+        std::ofstream    m_File;
+        std::string      m_Buffer;
+        std::uint64_t    m_FileBytes = 0;      // bytes already in the current file
+        std::int64_t     m_OpenedNs = 0;       // when this sink opened the current file (rotation clock)
+        std::int64_t     m_OldestNs = 0;       // first buffered line, 0 when the buffer is empty
+        bool             m_Urgent = false;     // a line at flushLevel is buffered
+        std::mutex       m_Mutex;              // sinks may be shared between loggers
+    };
+
+} // namespace FrameKit
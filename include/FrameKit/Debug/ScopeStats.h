@@ -0,0 +1,85 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/Debug/ScopeStats.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Aggregated per-scope timing statistics. The Instrumentor keeps one
+//      log-linear histogram per scope name and thread; snapshots merge them
+//      so long sessions can be monitored without keeping individual records.
+// =============================================================================
+
+#pragma once
+
+#include "FrameKit/Engine/Defines.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace FrameKit {
+
+    // Bucket layout shared by the recorder and the snapshots: values below 16
+    // get a bucket each, above that every power of two is split into 16
+    // sub-buckets (HDR-style, at most ~6% relative error).
+    namespace ScopeHistogram {
+        inline constexpr std::uint32_t kSubBits = 4;
+        inline constexpr std::uint32_t kSub = 1u << kSubBits;
+        inline constexpr std::uint32_t kBuckets = (64 - kSubBits + 1) * kSub;
+
+        FK_NODISCARD constexpr std::uint32_t BucketOf(std::uint64_t v) noexcept {
+            if (v < kSub) return static_cast<std::uint32_t>(v);
+            const std::uint32_t e = static_cast<std::uint32_t>(std::bit_width(v)) - 1;
+            const std::uint32_t sub = static_cast<std::uint32_t>(v >> (e - kSubBits)) & (kSub - 1);
+            return (e - kSubBits + 1) * kSub + sub;
+        }
+
+        // Smallest value that falls into bucket i
+        FK_NODISCARD constexpr std::uint64_t BucketLower(std::uint32_t i) noexcept {
+            if (i < kSub) return i;
+            const std::uint32_t e = i / kSub + kSubBits - 1;
+            return static_cast<std::uint64_t>(kSub + i % kSub) << (e - kSubBits);
+        }
+    } // namespace ScopeHistogram
+
+    struct ScopeStatsSettings {
+        double        reportIntervalSec{ 10.0 };  // periodic summary to the core log; 0 = snapshots only
+        std::uint32_t reportTopScopes{ 20 };      // scopes per report, by total time
+
+        bool operator==(const ScopeStatsSettings&) const = default;
+    };
+
+    struct ScopeStats {
+        std::string                name;
+        std::uint64_t              count = 0;
+        double                     totalNs = 0.0;
+        double                     minNs = 0.0;
+        double                     maxNs = 0.0;
+        double                     nsPerTick = 1.0;   // bucket values are trace ticks
+        std::vector<std::uint64_t> buckets;           // ScopeHistogram::kBuckets entries
+
+        FK_NODISCARD double MeanNs() const noexcept { return count ? totalNs / static_cast<double>(count) : 0.0; }
+        // q in [0, 1]; midpoint of the bucket holding the q-th sample, clamped to [min, max]
+        FK_NODISCARD double PercentileNs(double q) const noexcept;
+    };
+
+    struct ScopeStatsSnapshot {
+        std::int64_t            takenNs = 0;   // Instrumentor::NowNs()
+        std::int64_t            sinceNs = 0;   // start of the covered interval
+        std::uint64_t           frames = 0;    // Instrumentor::FrameEnd() calls in the interval
+        std::uint64_t           dropped = 0;   // samples lost because a thread's scope table was full
+        std::vector<ScopeStats> scopes;        // sorted by total time, largest first
+
+        FK_NODISCARD const ScopeStats* Find(const std::string& name) const noexcept;
+        // What happened between `earlier` and this snapshot. min/max become
+        // bucket bounds because exact extremes cannot be subtracted.
+        FK_NODISCARD ScopeStatsSnapshot Since(const ScopeStatsSnapshot& earlier) const;
+        // One line per scope: calls, calls/frame, mean, p50/p99/p999, max
+        FK_NODISCARD std::vector<std::string> FormatReport(std::size_t maxScopes) const;
+    };
+
+} // namespace FrameKit
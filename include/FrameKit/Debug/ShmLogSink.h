@@ -0,0 +1,108 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/Debug/ShmLogSink.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Log sink that publishes lines into a named shared-memory ring so an
+//      external process (Tools/ShmLogViewer) can tail many instances without
+//      file I/O. The writer never waits for readers: the ring overwrites the
+//      oldest slots and a slow reader detects the gap and skips ahead.
+//
+//      Segments: "fk_shm_log_<pid>_<n>" holds the ShmLogRing of the n-th sink
+//      created by a process, and "fk_shm_log_directory" lists the live rings
+//      for discovery.
+// =============================================================================
+
+#pragma once
+
+#include "FrameKit/Debug/LogSink.h"
+#include "FrameKit/SharedMemory/SharedMemory.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace FrameKit {
+
+    // ---- Shared layouts (also read by the viewer; keep them POD-like) ----
+    // Both segments are valid when zero-filled, so a reader that races the
+    // creator only ever sees empty state.
+
+    struct ShmLogSlot {
+        static constexpr std::size_t  kSize = 256;
+        static constexpr std::uint8_t kContinued = 0x1;   // line continues in the next slot
+
+        // 2n+1 while record n is being written, 2n+2 once it is complete
+        std::atomic<std::uint64_t> stamp;
+        std::int64_t               unixNs;
+        std::uint16_t              length;
+        LogLevel                   level;
+        std::uint8_t               flags;
+        char                       text[kSize - 20];
+    };
+    static_assert(sizeof(ShmLogSlot) == ShmLogSlot::kSize, "shared log slot layout changed");
+
+    struct ShmLogRing {
+        static constexpr std::uint32_t kMagic = 0x474C4B46u;   // "FKLG"
+        static constexpr std::uint32_t kVersion = 1;
+        static constexpr std::uint64_t kSlots = 4096;          // power of two
+
+        std::uint32_t              magic;
+        std::uint32_t              version;
+        std::uint32_t              pid;
+        std::uint32_t              reserved;
+        std::atomic<std::uint64_t> head;                       // records published so far
+        char                       name[32];                   // process/app label
+        char                       pad[ShmLogSlot::kSize - 56];
+        ShmLogSlot                 slots[kSlots];
+    };
+    static_assert(offsetof(ShmLogRing, slots) == ShmLogSlot::kSize, "shared log ring header layout changed");
+
+    struct ShmLogDirectory {
+        static constexpr std::uint32_t kEntries = 64;
+        static constexpr std::size_t   kNameSize = 48;
+
+        struct Entry {
+            std::atomic<std::uint32_t> pid;                    // 0 = free
+            char                       segment[kNameSize];     // written before pid is published
+        };
+
+        Entry entries[kEntries];
+    };
+
+    inline constexpr const char* kShmLogDirectoryName = "fk_shm_log_directory";
+
+    class ShmLogSink final : public LogSink {
+    public:
+        // Creates "fk_shm_log_<pid>_<n>" and registers it in the directory.
+        // `label` is shown by the viewer (e.g. the application name).
+        explicit ShmLogSink(const std::string& label);
+        ~ShmLogSink() override;
+
+        ShmLogSink(const ShmLogSink&) = delete;
+        ShmLogSink& operator=(const ShmLogSink&) = delete;
+
+        FK_NODISCARD bool IsOpen() const noexcept { return m_Ring != nullptr; }
+        FK_NODISCARD const std::string& SegmentName() const noexcept { return m_Segment; }
+
+        void Write(LogLevel level, std::int64_t unixNs, std::string_view line) override;
+        void Flush() override {}
+
+    private:
+        void Register();
+        void Unregister();
+
+        std::string                m_Segment;
+        FKShmHandle                m_Handle = nullptr;
+        ShmLogRing*                m_Ring = nullptr;
+        FKShmHandle                m_DirHandle = nullptr;
+        ShmLogDirectory::Entry*    m_DirEntry = nullptr;
+        std::mutex                 m_Mutex;        // single producer per ring
+    };
+
+} // namespace FrameKit
@@ -0,0 +1,114 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/Debug/TraceFormat.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Trace file formats written by the Instrumentor: Chrome trace JSON and
+//      a compact binary format (".fktrace") with interned names and
+//      varint-delta timestamps, about a tenth of the size. Tools/TraceConvert
+//      turns compact traces into JSON for chrome://tracing or Perfetto.
+//
+//      Compact layout (all varints are unsigned LEB128, "svarint" is zigzag):
+//        file     := magic "FKTRACE1" record*
+//        record   := tag:u8 payload
+//        0x01 string   := id:varint len:varint bytes[len]      (defined before first use)
+//        0x02 session  := len:varint bytes[len]
+//        0x10+kind event := tid:varint nameId:varint dt:svarint  kind-specific
+//            dt is nanoseconds since the previous event of the same tid; the first
+//            event of a tid is relative to 0, so its dt is its full timestamp
+//            Complete: dur:varint (ns)   Counter: f64 little-endian
+//            Flow*/Frame*: id:varint     Instant: nothing
+//      There is no footer; readers stop at the first incomplete record, so a
+//      trace cut short by a crash stays readable.
+// =============================================================================
+
+#pragma once
+
+#include "FrameKit/Engine/Defines.h"
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace FrameKit {
+
+    enum class TraceEventKind : std::uint8_t {
+        Complete,      // scope: start + duration ("X")
+        Counter,       // value track ("C")
+        Instant,       // point in time ("i")
+        FlowBegin,     // arrow from the enclosing scope... ("s")
+        FlowEnd,       // ...to the enclosing scope on another thread ("f")
+        FrameBegin,    // "B"/"E" pair named "Frame" around one host frame
+        FrameEnd
+    };
+
+    enum class TraceFormat : std::uint8_t {
+        ChromeJson,    // ".json"
+        Compact        // ".fktrace"
+    };
+
+    struct TraceEvent {
+        TraceEventKind   kind = TraceEventKind::Complete;
+        std::uint32_t    tid = 0;
+        std::string_view name;
+        std::int64_t     tsNs = 0;
+        std::int64_t     durNs = 0;     // Complete
+        std::uint64_t    id = 0;        // flow id or frame number
+        double           value = 0.0;   // Counter
+    };
+
+    namespace CompactTrace {
+        inline constexpr char          kMagic[8] = { 'F', 'K', 'T', 'R', 'A', 'C', 'E', '1' };
+        inline constexpr std::uint8_t  kTagString = 0x01;
+        inline constexpr std::uint8_t  kTagSession = 0x02;
+        inline constexpr std::uint8_t  kTagEvent = 0x10;   // + TraceEventKind
+    }
+
+    // Serializes events into a caller-owned buffer; the caller writes it out.
+    class TraceWriter {
+    public:
+        virtual ~TraceWriter() = default;
+
+        static std::unique_ptr<TraceWriter> Create(TraceFormat format);
+        FK_NODISCARD static const char* Extension(TraceFormat format) noexcept;
+
+        virtual void Begin(std::string& out, std::string_view session) = 0;
+        // nameKey identifies e.name for caching/interning: its address when the
+        // name has static storage duration, nullptr to key by content.
+        virtual void Write(std::string& out, const TraceEvent& e, const void* nameKey) = 0;
+        virtual void End(std::string& out) = 0;
+    };
+
+    // Reads a compact trace. Names stay valid for the reader's lifetime.
+    class CompactTraceReader {
+    public:
+        bool Open(const std::filesystem::path& path);
+        // False at the end of the file or at a truncated/corrupt record.
+        bool Next(TraceEvent& e);
+
+        FK_NODISCARD const std::string& Session() const noexcept { return m_Session; }
+        FK_NODISCARD bool Truncated() const noexcept { return m_Truncated; }
+
+    private:
+        bool ReadRecord(TraceEvent& e);      // one record of any kind; false if incomplete
+        bool ReadVarint(std::uint64_t& v) noexcept;
+        bool ReadBytes(std::string_view& s, std::size_t n) noexcept;
+
+        std::string                                     m_Data;
+        std::size_t                                     m_Pos = 0;
+        bool                                            m_Truncated = false;
+        bool                                            m_HaveEvent = false;  // last record was an event
+        std::string                                     m_Session;
+        std::deque<std::string>                         m_Names;      // by id; deque keeps views stable
+        std::unordered_map<std::uint64_t, std::size_t>  m_NameIndex;  // id -> m_Names slot
+        std::unordered_map<std::uint32_t, std::int64_t> m_LastTs;     // per tid
+    };
+
+} // namespace FrameKit
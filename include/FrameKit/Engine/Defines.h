@@ -3,7 +3,7 @@
 // File         : include/FrameKit/Engine/Defines.h 
 // Author       : George Gil
 // Created      : 2025-09-09
-// Updated      : 2025-09-09
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
 //      Core defines: build config toggles, compiler attributes, visibility.
@@ -62,6 +62,21 @@
 #define FK_UNLIKELY(x) (x)
 #endif
 
+// Spin-wait hint for busy loops (pause / yield instruction)
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define FK_CPU_RELAX() _mm_pause()
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define FK_CPU_RELAX() __builtin_ia32_pause()
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__aarch64__) || defined(__arm__))
+#define FK_CPU_RELAX() __asm__ __volatile__("yield")
+#else
+#define FK_CPU_RELAX() ((void)0)
+#endif
+
+// Destructive interference size used to keep hot atomics on separate lines
+#define FK_CACHELINE_SIZE 64
+
 #define FK_EXPAND_MACRO(x)    x
 #define FK_STRINGIFY_MACRO(x) #x
 #define FK_CONCAT_IMPL(a,b)   a##b
@@ -0,0 +1,126 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/Engine/JobSystem.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Work-stealing job system. Each worker owns a bounded deque; idle workers
+//      steal from the others. Jobs may depend on other jobs and can be joined
+//      with Wait(), which helps execute pending work instead of blocking.
+// =============================================================================
+
+#pragma once
+
+#include "FrameKit/Engine/Defines.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace FrameKit {
+
+    namespace detail { struct Job; }
+
+    // Reference-counted handle to a scheduled job. An empty handle counts as done.
+    class JobHandle {
+    public:
+        JobHandle() noexcept = default;
+        JobHandle(const JobHandle& other) noexcept;
+        JobHandle(JobHandle&& other) noexcept;
+        JobHandle& operator=(const JobHandle& other) noexcept;
+        JobHandle& operator=(JobHandle&& other) noexcept;
+        ~JobHandle();
+
+        FK_NODISCARD bool Valid() const noexcept { return m_Job != nullptr; }
+        FK_NODISCARD bool IsDone() const noexcept;
+
+    private:
+        friend class JobSystem;
+        explicit JobHandle(detail::Job* job) noexcept : m_Job(job) {} // adopts one reference
+
+        detail::Job* m_Job = nullptr;
+    };
+
+    class JobSystem {
+    public:
+        using JobFn = std::function<void()>;
+        using RangeFn = std::function<void(std::size_t begin, std::size_t end)>;
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        JobSystem(JobSystem&&) = delete;
+        JobSystem& operator=(JobSystem&&) = delete;
+
+        static JobSystem& Get() noexcept;
+
+        // workerCount == 0 => hardware_concurrency() - 1 (at least one worker)
+        void Init(std::uint32_t workerCount = 0);
+        // Runs all queued work to completion, including continuations and jobs
+        // scheduled by running jobs, then joins the workers. Jobs scheduled
+        // while it finishes up run inline.
+        void Shutdown();
+
+        FK_NODISCARD bool          IsRunning() const noexcept { return m_Running.load(std::memory_order_acquire); }
+        FK_NODISCARD std::uint32_t WorkerCount() const noexcept { return static_cast<std::uint32_t>(m_Workers.size()); }
+
+        // Without running workers jobs execute inline on the calling thread.
+        JobHandle Schedule(JobFn fn);
+        JobHandle Schedule(JobFn fn, const JobHandle& dependency);
+        JobHandle Schedule(JobFn fn, std::span<const JobHandle> dependencies);
+        JobHandle Schedule(JobFn fn, std::initializer_list<JobHandle> dependencies);
+
+        // Join. The calling thread executes other pending jobs while it waits, so do
+        // not wait while holding a lock that queued jobs may take.
+        void Wait(const JobHandle& handle);
+        void WaitAll(std::span<const JobHandle> handles);
+
+        // Splits [0, count) into chunks of at most `grain` items and waits for all of them.
+        void ParallelFor(std::size_t count, std::size_t grain, const RangeFn& fn);
+
+        // Index of the calling worker, or -1 for threads not owned by the job system.
+        FK_NODISCARD static int CurrentWorkerIndex() noexcept;
+
+    private:
+        struct Worker;
+
+        JobSystem() = default;
+        ~JobSystem();
+
+        void Enqueue(detail::Job* job);
+        detail::Job* TryAcquire(int self);
+        detail::Job* PopGlobal();
+        detail::Job* Steal(int self);
+        void Execute(detail::Job* job);
+        void RunAcquired(detail::Job* job);   // Execute() a job taken from a queue
+        void Drain();
+        void WorkerMain(int index);
+
+    private:
+        std::vector<std::unique_ptr<Worker>> m_Workers;
+        std::atomic<bool>                    m_Running{ false };
+        std::atomic<bool>                    m_Stop{ false };
+
+        // Submissions from non-worker threads and deque overflow
+        std::mutex                           m_GlobalMutex;
+        std::vector<detail::Job*>            m_Global;
+        std::size_t                          m_GlobalHead = 0;
+
+        // Sleep/wake bookkeeping
+        alignas(FK_CACHELINE_SIZE) std::atomic<std::int64_t> m_Queued{ 0 };
+        std::atomic<std::int64_t>            m_Outstanding{ 0 };   // enqueued, not yet finished executing
+        std::atomic<std::int32_t>            m_Sleepers{ 0 };
+        std::mutex                           m_SleepMutex;
+        std::condition_variable              m_SleepCv;
+    };
+
+} // namespace FrameKit
@@ -3,7 +3,7 @@
 // File         : include/FrameKit/Engine/Layer.h
 // Author       : George Gil
 // Created      : 2025-09-08
-// Updated      : 2025-09-09
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
 //          Base interface for engine layers.Provides lifecycle hooks,
@@ -16,7 +16,10 @@
 #include "FrameKit/Utilities/Time.h"
 #include "FrameKit/Events/Event.h"
 
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace FrameKit
 {
@@ -32,15 +35,23 @@ namespace FrameKit
         virtual void OnAttach() {}
         virtual void OnDetach() {}
 
-		// Per-frame update in the main thread
+		// Per-frame update. Runs on the main thread unless the layer declares its
+		// accesses (see below); declared layers may run on job workers, concurrently
+		// with other layers they do not conflict with.
         virtual void OnSyncUpdate(Timestep) {}
 
+		// Fixed-step update (LoopSettings::fixedUpdateHz > 0). Runs zero or more
+		// times per frame before OnSyncUpdate, always with the same timestep, and
+		// is scheduled with the same dependency rules as OnSyncUpdate.
+        virtual void OnFixedUpdate(Timestep) {}
+
 		// Called in the main thread if the layer supports rendering
 		// Only in windowed mode
         virtual void OnRender() {}
         
-		// Async update, called in a separate thread if the layer supports it
-		// StartAsyncThread must be called by the application to enable this
+		// Async update, called on a JobSystem worker once per frame while
+		// ApplicationSpecification::Jobs.asyncLayerUpdate is set. A new pass only
+		// starts after the previous one has finished, so it never overlaps itself.
 		// Note: Thread safety must be ensured by the layer implementation
         virtual void OnAsyncUpdate() {}
 
@@ -49,7 +60,30 @@ namespace FrameKit
 
         FK_NODISCARD const std::string& GetName() const noexcept { return m_DebugName; }
 
+        // ---- Update scheduling ----
+        // A layer that declares nothing is exclusive: it is ordered against every
+        // other layer, exactly like the serial stack walk. Once a layer declares
+        // reads/writes it only waits for earlier layers it conflicts with
+        // (write/write or read/write on the same resource) and for explicit
+        // RunAfter() edges. Declare from the constructor or OnAttach().
+        void DeclareRead(std::string_view resource);
+        void DeclareWrite(std::string_view resource);
+        void RunAfter(std::string_view layerName);
+
+        FK_NODISCARD bool HasSchedulingInfo() const noexcept { return m_Declared; }
+        FK_NODISCARD const std::vector<std::uint64_t>& GetReads() const noexcept { return m_Reads; }
+        FK_NODISCARD const std::vector<std::uint64_t>& GetWrites() const noexcept { return m_Writes; }
+        FK_NODISCARD const std::vector<std::string>& GetRunAfter() const noexcept { return m_RunAfter; }
+        FK_NODISCARD std::uint32_t GetSchedulingVersion() const noexcept { return m_SchedulingVersion; }
+
     protected:
         std::string m_DebugName;
+
+    private:
+        std::vector<std::uint64_t> m_Reads;          // hashed resource ids
+        std::vector<std::uint64_t> m_Writes;
+        std::vector<std::string>   m_RunAfter;
+        std::uint32_t              m_SchedulingVersion = 0;
+        bool                       m_Declared = false;
     };
 }
@@ -3,7 +3,7 @@
 // File         : include/FrameKit/Events/Event.h
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-11
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Event base class
 // =============================================================================
@@ -66,17 +66,19 @@ namespace FrameKit {
 
     class EventDispatcher {
     public:
-        explicit EventDispatcher(Event& e) : m_Event(e) {}
+        // The type is read once; every Dispatch<T>() is then a plain compare
+        explicit EventDispatcher(Event& e) : m_Event(e), m_Type(e.GetEventType()) {}
         template<typename T, typename F>
         bool Dispatch(const F& func) {
-            if (m_Event.GetEventType() == T::GetStaticType()) {
+            if (m_Type == T::GetStaticType()) {
                 m_Event.Handled |= func(static_cast<T&>(m_Event));
                 return true;
             }
             return false;
         }
     private:
-        Event& m_Event;
+        Event&    m_Event;
+        EventType m_Type;
     };
 
     inline std::ostream& operator<<(std::ostream& os, const Event& e) {
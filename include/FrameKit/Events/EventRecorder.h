@@ -0,0 +1,118 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/Events/EventRecorder.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Binary event recording and replay
+//      The recorder taps window input where it enters the engine
+//      (SetWindowInputTap) plus the host's per-frame Timestep. Events the app
+//      posts itself are not recorded: replay reruns the app, which posts them
+//      again. The replayer feeds a recording back frame by frame, so a
+//      session can be rerun headless and unpaced.
+//
+//      File layout (fields in struct order, little-endian):
+//        FileHeader
+//        { Record [payload] }*    Event records belong to the next Frame record;
+//                                 the Frame record carries that frame's delta.
+// =============================================================================
+
+#pragma once
+
+#include "FrameKit/Engine/Defines.h"
+#include "FrameKit/Events/Event.h"
+#include "FrameKit/Utilities/Time.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <vector>
+
+namespace FrameKit {
+
+namespace EventRecording {
+    inline constexpr char          kMagic[4] = { 'F', 'K', 'E', 'R' };
+    inline constexpr std::uint16_t kVersion = 1;
+
+    struct FileHeader {
+        char          magic[4];
+        std::uint16_t version;
+        std::uint16_t headerSize;   // sizeof(FileHeader)
+        std::uint32_t reserved;
+    };
+
+    enum class RecordKind : std::uint8_t { Event = 1, Frame = 2 };
+
+    struct Record {
+        RecordKind    kind;
+        std::uint8_t  type;         // EventType for Event records
+        std::uint16_t size;         // payload bytes that follow
+    };
+
+    struct FramePayload {
+        float         dt;           // seconds
+        std::uint32_t events;       // Event records since the previous Frame record
+    };
+
+    static_assert(sizeof(FileHeader) == 12 && sizeof(Record) == 4 && sizeof(FramePayload) == 8,
+                  "event recording structs must stay packed");
+}
+
+class EventRecorder {
+public:
+    EventRecorder() = default;
+    ~EventRecorder() { Close(); }
+    EventRecorder(const EventRecorder&) = delete;
+    EventRecorder& operator=(const EventRecorder&) = delete;
+
+    bool Open(const std::filesystem::path& path);
+    void Close();
+    FK_NODISCARD bool IsOpen() const noexcept { return m_File != nullptr; }
+
+    // Any thread. Events without a serialised form (no payload mapping) are
+    // counted and skipped.
+    void Record(const Event& e);
+    void EndFrame(Timestep dt);
+
+    FK_NODISCARD std::uint64_t Frames() const noexcept { return m_Frames; }
+    FK_NODISCARD std::uint64_t Events() const noexcept { return m_Events; }
+    FK_NODISCARD std::uint64_t Skipped() const noexcept { return m_Skipped; }
+
+private:
+    std::mutex    m_Mutex;   // guards the file and counters while recording
+    std::FILE*    m_File = nullptr;
+    std::uint32_t m_FrameEvents = 0;
+    std::uint64_t m_Frames = 0;
+    std::uint64_t m_Events = 0;
+    std::uint64_t m_Skipped = 0;
+};
+
+class EventReplayer {
+public:
+    EventReplayer() = default;
+    ~EventReplayer() { Close(); }
+    EventReplayer(const EventReplayer&) = delete;
+    EventReplayer& operator=(const EventReplayer&) = delete;
+
+    bool Open(const std::filesystem::path& path);
+    void Close();
+    FK_NODISCARD bool IsOpen() const noexcept { return m_File != nullptr; }
+
+    // Posts the next frame's events through GlobalEventHandler and returns its
+    // recorded delta. False once the stream is exhausted (trailing events are
+    // still posted) or malformed.
+    bool NextFrame(Timestep& dt);
+
+    FK_NODISCARD std::uint64_t Frames() const noexcept { return m_Frames; }
+    FK_NODISCARD std::uint64_t Events() const noexcept { return m_Events; }
+
+private:
+    std::FILE*                m_File = nullptr;
+    std::vector<std::uint8_t> m_Payload;
+    std::uint64_t             m_Frames = 0;
+    std::uint64_t             m_Events = 0;
+};
+
+} // namespace FrameKit
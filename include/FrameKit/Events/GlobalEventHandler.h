@@ -3,35 +3,198 @@
 // File         : src/FrameKit/Core/Events/GlobalEventHandler.h
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-10
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Global event handler
+//      Listeners subscribe to an EventType, an EventCategory mask or to all
+//      events, as plain (function pointer, context) delegates. Each EventType
+//      has an immutable dispatch list, so emitting only visits interested
+//      listeners and never allocates or locks.
+//      Emit() dispatches synchronously. Post() either dispatches right away
+//      (Immediate mode) or copies the event into a per-frame arena and queues it
+//      on a lock-free MPSC list (Deferred mode); the host delivers queued events
+//      once per frame with Drain().
 // =============================================================================
 
 #pragma once
 
 #include "FrameKit/Events/Event.h"
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace FrameKit {
 
+// Non-owning callable: a function pointer plus an opaque context
+struct EventDelegate {
+    using Fn = void (*)(void* ctx, Event& e);
+
+    Fn    fn = nullptr;
+    void* ctx = nullptr;
+
+    void operator()(Event& e) const { fn(ctx, e); }
+    explicit operator bool() const noexcept { return fn != nullptr; }
+
+    // EventDelegate::Bind<&MyLayer::OnAnyEvent>(this)   -- void (C::*)(Event&)
+    template<auto Method, typename C>
+    static EventDelegate Bind(C* obj) noexcept {
+        return { [](void* c, Event& e) { (static_cast<C*>(c)->*Method)(e); }, obj };
+    }
+};
+
 // Simple global event handler singleton
 class GlobalEventHandler {
 public:
     using Listener = std::function<void(Event&)>;
+    using ListenerId = std::uint64_t;   // also returned by the Subscribe* family
+
+    enum class Mode : std::uint8_t { Immediate = 0, Deferred = 1 };
 
     static GlobalEventHandler& Get();
 
-    void AddListener(const Listener& l);
+    // ---- Subscriptions (any thread; listeners run in subscription order) ----
+    ListenerId Subscribe(EventType type, EventDelegate d);
+    ListenerId SubscribeCategory(EventCategoryBits mask, EventDelegate d);   // any overlapping bit
+    ListenerId SubscribeAll(EventDelegate d);
+    void Unsubscribe(ListenerId id);
+
+    // Typed member binding: Subscribe<MouseMovedEvent, &MyLayer::OnMouseMoved>(this)
+    template<typename T, auto Method, typename C>
+    ListenerId Subscribe(C* obj) {
+        return Subscribe(T::GetStaticType(),
+            EventDelegate{ [](void* c, Event& e) { (static_cast<C*>(c)->*Method)(static_cast<T&>(e)); }, obj });
+    }
+
+    // Legacy: std::function listener for every event (allocates once, here)
+    ListenerId AddListener(const Listener& l);
+    void RemoveListener(ListenerId id) { Unsubscribe(id); }
+
+    // Synchronous dispatch on the calling thread. Listeners may emit re-entrantly.
     void Emit(Event& e);
 
+    // Any thread. Immediate: same as Emit(). Deferred: the event is stored
+    // inline in the current frame arena (heap if the arena is full) and
+    // delivered, in post order, by the next Drain().
+    template<typename T>
+    void Post(T e);
+
+    // Owner (main) thread. Delivers everything posted before the call; events
+    // posted by listeners while draining go to the next Drain(). Returns the
+    // number of events delivered.
+    std::size_t Drain();
+
+    void SetMode(Mode m) noexcept { m_Mode.store(m, std::memory_order_release); }
+    FK_NODISCARD Mode GetMode() const noexcept { return m_Mode.load(std::memory_order_acquire); }
+
+    // Deferred mode: called once per batch, when a thread other than the
+    // draining one first posts after a Drain(), so an idle host can wake up and
+    // deliver the event. Pass nullptr to remove.
+    void SetWaker(void (*fn)(void*), void* ctx);
+
+    // Bytes per arena buffer (two buffers are used). Call before the first Post().
+    void SetArenaCapacity(std::size_t bytes);
+
+    // Events that did not fit in the arena and were heap-allocated
+    FK_NODISCARD std::uint64_t OverflowCount() const noexcept { return m_Overflow.load(std::memory_order_relaxed); }
+
+private:
+    // ---- Dispatch tables ----
+    static constexpr std::size_t       kTypeCount = static_cast<std::size_t>(EventType::UpdateParameter) + 1;
+    static constexpr EventCategoryBits kCategoryKnown = EventCategoryBits(1) << 63;
+
+    enum class SubKind : std::uint8_t { Type, Category, All };
+    struct Subscription {
+        ListenerId                id = 0;
+        SubKind                   kind = SubKind::All;
+        EventType                 type = EventType::None;
+        EventCategoryBits         mask = 0;
+        EventDelegate             fn{};
+        std::unique_ptr<Listener> owned;   // AddListener only
+    };
+    struct DispatchList { std::vector<EventDelegate> items; };
+
+    ListenerId AddSubscription(Subscription sub);
+    void LearnCategory(std::size_t index, EventCategoryBits flags);
+    void RebuildLocked(std::size_t index);
+    void PublishLocked(std::size_t index, DispatchList* list);
+    void ReclaimLocked();
+
+    // ---- Deferred queue ----
+    struct QueuedEvent {
+        std::atomic<QueuedEvent*> next{ nullptr };
+        Event*                    event = nullptr;
+        void                      (*destroy)(Event*) noexcept = nullptr;
+        std::size_t               heapAlign = 0;   // 0 => lives in the arena
+    };
+
+    struct Buffer {
+        std::unique_ptr<std::byte[]>                         mem;
+        std::size_t                                          capacity = 0;
+        alignas(FK_CACHELINE_SIZE) std::atomic<std::size_t>  used{ 0 };
+        alignas(FK_CACHELINE_SIZE) std::atomic<std::uint32_t> writers{ 0 };
+        alignas(FK_CACHELINE_SIZE) std::atomic<QueuedEvent*> head{ nullptr }; // last pushed (producers)
+        QueuedEvent                                          stub;              // first node (consumer)
+        std::atomic<bool>                                    woken{ false };    // waker called for this batch
+    };
+
+    struct Slot {
+        Buffer*      buffer = nullptr;
+        QueuedEvent* node = nullptr;
+        void*        payload = nullptr;
+    };
+
+    GlobalEventHandler();
+    ~GlobalEventHandler();
+
+    Slot BeginPost(std::size_t size, std::size_t align);
+    void EndPost(const Slot& s, Event* e, void (*destroy)(Event*) noexcept) noexcept;
+    static void ResetBuffer(Buffer& b) noexcept;
+
 private:
-    GlobalEventHandler() = default;
-    std::vector<Listener> m_Listeners;
-    std::mutex m_Mutex;
+    std::array<std::atomic<const DispatchList*>, kTypeCount>  m_Lists{};
+    std::array<std::atomic<EventCategoryBits>, kTypeCount>    m_Categories{};  // kCategoryKnown | flags once seen
+    alignas(FK_CACHELINE_SIZE) std::atomic<std::uint32_t>     m_ActiveEmits{ 0 };
+
+    std::mutex                                 m_Mutex;         // guards everything below
+    std::vector<Subscription>                  m_Subs;          // id order
+    std::vector<const DispatchList*>           m_RetiredLists;  // freed once no Emit() is in flight
+    std::vector<std::unique_ptr<Listener>>     m_RetiredOwned;
+    ListenerId                                 m_NextId = 1;
+
+    std::atomic<Mode>                          m_Mode{ Mode::Immediate };
+    Buffer                                     m_Buffers[2];
+    alignas(FK_CACHELINE_SIZE) std::atomic<std::uint32_t> m_Active{ 0 };
+    std::atomic<std::uint64_t>                 m_Overflow{ 0 };
+    bool                                       m_Draining = false;
+    std::atomic<std::thread::id>               m_DrainThread{};
+
+    std::mutex                                 m_WakeMutex;
+    void                                       (*m_WakeFn)(void*) = nullptr;
+    void*                                      m_WakeCtx = nullptr;
 };
 
+template<typename T>
+void GlobalEventHandler::Post(T e) {
+    static_assert(std::is_base_of_v<Event, T>, "Post<T>: T must derive from Event");
+    // A throw between BeginPost() and EndPost() would leave Drain() waiting on the writer
+    static_assert(std::is_nothrow_move_constructible_v<T>, "Post<T>: T must be nothrow move constructible");
+    if (GetMode() == Mode::Immediate) {
+        Emit(e);
+        return;
+    }
+    const Slot s = BeginPost(sizeof(T), alignof(T));
+    T* stored = ::new (s.payload) T(std::move(e));
+    EndPost(s, stored, [](Event* p) noexcept { static_cast<T*>(p)->~T(); });
+}
+
 } // namespace FrameKit
@@ -2,7 +2,7 @@
 // Project      : FrameKit
 // File         : include/FrameKit/Events/MouseEvent.h
 // Author       : George Gil
-// Updated      : 2025-09-10
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Mouse input events
 // =============================================================================
@@ -11,36 +11,56 @@
 
 #include "FrameKit/Events/Event.h"
 #include "FrameKit/Input/MouseCodes.h"
+#include <cstdint>
+#include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace FrameKit {
 
+struct MouseMoveSample { float x, y; };
+using MouseMoveHistory = std::shared_ptr<const std::vector<MouseMoveSample>>;
+
+// With coalescing enabled one event stands for several raw cursor updates:
+// the position is the last one, the history (if requested) holds all of them.
 class MouseMovedEvent final : public Event {
 public:
     MouseMovedEvent(float x, float y) : m_X(x), m_Y(y) {}
+    MouseMovedEvent(float x, float y, std::uint32_t coalesced, MouseMoveHistory history)
+        : m_X(x), m_Y(y), m_Coalesced(coalesced), m_History(std::move(history)) {}
     float GetX() const { return m_X; }
     float GetY() const { return m_Y; }
+    std::uint32_t GetCoalescedCount() const { return m_Coalesced; }
+    std::span<const MouseMoveSample> GetHistory() const {
+        return m_History ? std::span<const MouseMoveSample>(*m_History) : std::span<const MouseMoveSample>{};
+    }
     std::string ToString() const override {
         return "MouseMoved: " + std::to_string(m_X) + "," + std::to_string(m_Y);
     }
     EVENT_CLASS_TYPE(MouseMoved)
     EVENT_CLASS_CATEGORY(EventCategoryMouse | EventCategoryInput)
 private:
-    float m_X, m_Y;
+    float            m_X, m_Y;
+    std::uint32_t    m_Coalesced = 1;
+    MouseMoveHistory m_History;
 };
 
+// Coalesced scroll events carry the summed offsets
 class MouseScrolledEvent final : public Event {
 public:
-    MouseScrolledEvent(float dx, float dy) : m_Dx(dx), m_Dy(dy) {}
+    MouseScrolledEvent(float dx, float dy, std::uint32_t coalesced = 1) : m_Dx(dx), m_Dy(dy), m_Coalesced(coalesced) {}
     float GetXOffset() const { return m_Dx; }
     float GetYOffset() const { return m_Dy; }
+    std::uint32_t GetCoalescedCount() const { return m_Coalesced; }
     std::string ToString() const override {
         return "MouseScrolled: " + std::to_string(m_Dx) + "," + std::to_string(m_Dy);
     }
     EVENT_CLASS_TYPE(MouseScrolled)
     EVENT_CLASS_CATEGORY(EventCategoryMouse | EventCategoryInput)
 private:
-    float m_Dx, m_Dy;
+    float         m_Dx, m_Dy;
+    std::uint32_t m_Coalesced;
 };
 
 class MouseButtonEvent : public Event {
@@ -14,7 +14,7 @@
 // File         : include/FrameKit/FrameKit.h
 // Author       : George Gil
 // Created      : 2025-09-07
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
 //      Main include file for the FrameKit framework.
@@ -34,6 +34,7 @@
 // FrameKit Core Functionality
 #include "FrameKit/Application/Application.h"
 #include "FrameKit/Engine/Layer.h"
+#include "FrameKit/Engine/JobSystem.h"
 
 // Debugging and Profiling
 #include "FrameKit/Debug/Log.h"
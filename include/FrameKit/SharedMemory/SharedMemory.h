@@ -3,7 +3,7 @@
 // File         : include/FrameKit/SharedMemory/SharedMemory.h
 // Author       : George Gil
 // Created      : 2025-09-11
-// Updated      : 2025-09-11
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Public API for cross-platform shared memory
 // =============================================================================
@@ -14,6 +14,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <new>
 
 // ---- Export / import --------------------------------------------------------
 #if defined(FK_PLATFORM_WINDOWS)
@@ -54,7 +55,11 @@ enum {
   FKSHM_ERR_NOT_FOUND         = -5,
   FKSHM_ERR_INCOMPATIBLE_VER  = -6,
   FKSHM_ERR_LAYOUT_MISMATCH   = -7,
-  FKSHM_ERR_MAP_FAILED        = -8
+  FKSHM_ERR_MAP_FAILED        = -8,
+  FKSHM_ERR_FULL              = -9,   // queues/rings: no space right now
+  FKSHM_ERR_EMPTY             = -10,  // queues/rings: nothing to read
+  FKSHM_ERR_TOO_LARGE         = -11,  // message exceeds the ring/slot size
+  FKSHM_ERR_TIMEOUT           = -12   // blocking call gave up
 };
 
 // ---- Control block layout (read-only to callers) ----------------------------
@@ -107,27 +112,51 @@ enum { FKSHM_MAGIC = 0xFD5A11EDu };
 // ---- Minimal C++ sugar ------------------------------------------------------
 namespace FrameKit::SHM {
 
-// Create/open typed payload T. Runs T() once if created.
+namespace detail {
+  // The payload follows the control block, so it is only 8-byte aligned.
+  // An over-aligned T sits at its first aligned address in the payload;
+  // mappings are page aligned, so that offset is the same in every process.
+  constexpr size_t kPayloadAlign = alignof(FKShmControlBlock);
+
+  template <class T>
+  constexpr size_t typed_size() noexcept {
+    static_assert(alignof(T) <= 4096, "shared objects cannot be aligned beyond a page");
+    return sizeof(T) + (alignof(T) > kPayloadAlign ? alignof(T) - kPayloadAlign : 0);
+  }
+
+  // First `align` boundary (a power of two) of the payload
+  inline void* aligned_payload(FKShmHandle h, size_t align) noexcept {
+    const uintptr_t p = reinterpret_cast<uintptr_t>(fk_shm_payload(h));
+    return reinterpret_cast<void*>((p + align - 1) & ~(uintptr_t(align) - 1));
+  }
+
+  template <class T>
+  inline T* typed_payload(FKShmHandle h) noexcept {
+    return static_cast<T*>(aligned_payload(h, alignof(T)));
+  }
+}
+
+// Create/open typed payload T (any alignment up to a page). Runs T() once if created.
 template <class T>
 inline T* CreateTyped(const char* name, FKShmOpenMode mode, FKShmHandle* out = nullptr) {
   FKShmHandle h = nullptr; int created = 0;
-  if (fk_shm_create_or_open(name, sizeof(T), mode, &h, &created) != FKSHM_OK) return nullptr;
+  if (fk_shm_create_or_open(name, detail::typed_size<T>(), mode, &h, &created) != FKSHM_OK) return nullptr;
   const FKShmControlBlock* cb = fk_shm_control(h);
-  if (!cb || cb->payloadSize != sizeof(T)) { fk_shm_close(h); return nullptr; }
-  void* p = fk_shm_payload(h);
+  if (!cb || cb->payloadSize != detail::typed_size<T>()) { fk_shm_close(h); return nullptr; }
+  T* p = detail::typed_payload<T>(h);
   if (created) new (p) T();
   if (out) *out = h; else fk_shm_close(h);
-  return static_cast<T*>(p);
+  return p;
 }
 
 // Open typed payload T without constructing.
 template <class T>
 inline T* OpenTyped(const char* name, FKShmHandle* out = nullptr) {
   FKShmHandle h = nullptr;
-  if (fk_shm_open_typed(name, sizeof(T), &h) != FKSHM_OK) return nullptr;
-  void* p = fk_shm_payload(h);
+  if (fk_shm_open_typed(name, detail::typed_size<T>(), &h) != FKSHM_OK) return nullptr;
+  T* p = detail::typed_payload<T>(h);
   if (out) *out = h; else fk_shm_close(h);
-  return static_cast<T*>(p);
+  return p;
 }
 
 inline void Close(FKShmHandle h) { fk_shm_close(h); }
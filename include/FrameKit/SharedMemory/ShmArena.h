@@ -0,0 +1,187 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/SharedMemory/ShmArena.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Heap inside an fk_shm segment, so object graphs can be shared without
+//      serializing them. Every process may allocate and free concurrently:
+//      blocks come from lock-free per-size-class free lists (classes grow in
+//      quarter steps, at most 25% slack) and fresh space is carved from the
+//      end. Freed blocks are reused by their own class only; nothing is
+//      coalesced, which suits long-lived graphs with recurring sizes.
+//
+//      Pointers stored inside the arena must be OffsetPtr (self-relative),
+//      since each process maps the segment at a different address. A root
+//      slot lets processes find the top-level object; containers built on
+//      this live in ShmContainers.h.
+// =============================================================================
+#pragma once
+
+#include "FrameKit/SharedMemory/SharedMemory.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Arena (lives at the start of the mapping; opaque) ---------------------
+typedef struct FKShmArenaHeader FKShmArenaHeader;
+
+typedef struct FKShmArenaStats {
+  uint64_t capacity;      // bytes available for blocks
+  uint64_t carved;        // bytes handed out from fresh space so far (incl. block headers)
+  uint64_t allocations;   // successful fk_shm_arena_alloc calls
+  uint64_t frees;         // fk_shm_arena_free calls that released a block
+} FKShmArenaStats;
+
+// ---- C API ------------------------------------------------------------------
+
+// Create or open the arena `name` with `size` bytes for blocks. Returns the
+// fk_shm handle (close it with fk_shm_close) and the arena inside it.
+FK_SHM_API int fk_shm_arena_create_or_open(const char*        name,
+                                           size_t             size,
+                                           FKShmOpenMode      mode,
+                                           FKShmHandle*       out_handle,
+                                           FKShmArenaHeader** out_arena,
+                                           int*               out_created);
+
+// 16-byte aligned block of at least `size` bytes, or NULL when the arena is exhausted.
+FK_SHM_API void* fk_shm_arena_alloc(FKShmArenaHeader* arena, size_t size);
+// Return a block from this arena. NULL and repeated frees are ignored.
+FK_SHM_API void  fk_shm_arena_free(FKShmArenaHeader* arena, void* ptr);
+// Usable size of a block (its size class).
+FK_SHM_API size_t fk_shm_arena_block_size(FKShmArenaHeader* arena, const void* ptr);
+
+// Root object: one pointer every process can find. set_root swaps `expected`
+// for `desired` atomically and returns 1 on success.
+FK_SHM_API void* fk_shm_arena_root(FKShmArenaHeader* arena);
+FK_SHM_API int   fk_shm_arena_set_root(FKShmArenaHeader* arena, void* expected, void* desired);
+
+FK_SHM_API int   fk_shm_arena_stats(FKShmArenaHeader* arena, FKShmArenaStats* out_stats);
+
+#ifdef __cplusplus
+} // extern "C"
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// ---- C++ layer --------------------------------------------------------------
+namespace FrameKit::SHM {
+
+// Self-relative pointer: stores the distance from itself to the target, so
+// it stays valid wherever the segment is mapped. Copying recomputes the
+// distance; never memcpy an object that contains one.
+template <class T>
+class OffsetPtr {
+public:
+  OffsetPtr() noexcept = default;
+  OffsetPtr(std::nullptr_t) noexcept {}
+  OffsetPtr(T* p) noexcept { Set(p); }
+  OffsetPtr(const OffsetPtr& o) noexcept { Set(o.Get()); }
+  template <class U, class = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+  OffsetPtr(const OffsetPtr<U>& o) noexcept { Set(o.Get()); }
+  OffsetPtr& operator=(const OffsetPtr& o) noexcept { Set(o.Get()); return *this; }
+  OffsetPtr& operator=(T* p) noexcept { Set(p); return *this; }
+
+  FK_NODISCARD T* Get() const noexcept {
+    if (m_Off == kNull) return nullptr;
+    return reinterpret_cast<T*>(const_cast<char*>(reinterpret_cast<const char*>(this)) + m_Off);
+  }
+  T* operator->() const noexcept { return Get(); }
+  std::add_lvalue_reference_t<T> operator*() const noexcept { return *Get(); }
+  explicit operator bool() const noexcept { return m_Off != kNull; }
+
+  friend bool operator==(const OffsetPtr& a, const OffsetPtr& b) noexcept { return a.Get() == b.Get(); }
+  friend bool operator==(const OffsetPtr& a, std::nullptr_t) noexcept { return !a; }
+
+private:
+  // 1 can never be the distance to a distinct object aligned like an OffsetPtr
+  static constexpr std::ptrdiff_t kNull = 1;
+
+  void Set(T* p) noexcept {
+    m_Off = p ? reinterpret_cast<const char*>(p) - reinterpret_cast<const char*>(this) : kNull;
+  }
+
+  std::ptrdiff_t m_Off = kNull;
+};
+
+// Process-local handle on an arena segment.
+class Arena {
+public:
+  Arena() = default;
+  ~Arena() { Close(); }
+  Arena(Arena&& o) noexcept
+    : m_Handle(std::exchange(o.m_Handle, nullptr)), m_Arena(std::exchange(o.m_Arena, nullptr)) {}
+  Arena& operator=(Arena&& o) noexcept {
+    if (this != &o) {
+      Close();
+      m_Handle = std::exchange(o.m_Handle, nullptr);
+      m_Arena = std::exchange(o.m_Arena, nullptr);
+    }
+    return *this;
+  }
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  // Returns an FKSHM_* code.
+  int Open(const char* name, size_t size, FKShmOpenMode mode, int* outCreated = nullptr) {
+    Close();
+    int created = 0;
+    const int rc = fk_shm_arena_create_or_open(name, size, mode, &m_Handle, &m_Arena, &created);
+    if (outCreated) *outCreated = created;
+    return rc;
+  }
+  void Close() { fk_shm_close(m_Handle); m_Handle = nullptr; m_Arena = nullptr; }
+
+  FK_NODISCARD bool IsOpen() const noexcept { return m_Arena != nullptr; }
+  FK_NODISCARD FKShmArenaHeader* Header() const noexcept { return m_Arena; }
+
+  FK_NODISCARD void* Allocate(size_t size) { return fk_shm_arena_alloc(m_Arena, size); }
+  void Deallocate(void* p) { fk_shm_arena_free(m_Arena, p); }
+
+  // Constructs T in the arena; nullptr when exhausted. Objects that hold
+  // arena memory take the arena as their first constructor argument.
+  template <class T, class... Args>
+  T* New(Args&&... args) {
+    static_assert(alignof(T) <= 16, "arena blocks are 16-byte aligned");
+    void* p = Allocate(sizeof(T));
+    return p ? new (p) T(std::forward<Args>(args)...) : nullptr;
+  }
+  template <class T>
+  void Delete(T* p) {
+    if (!p) return;
+    p->~T();
+    Deallocate(p);
+  }
+
+  // Returns the root as T, constructing it from args if no process has yet.
+  // The caller is responsible for every process agreeing on T.
+  template <class T, class... Args>
+  T* FindOrConstructRoot(Args&&... args) {
+    if (void* r = fk_shm_arena_root(m_Arena)) return static_cast<T*>(r);
+    T* mine = New<T>(std::forward<Args>(args)...);
+    if (!mine) return nullptr;
+    if (fk_shm_arena_set_root(m_Arena, nullptr, mine)) return mine;
+    Delete(mine);   // another process won the race
+    return static_cast<T*>(fk_shm_arena_root(m_Arena));
+  }
+
+  FK_NODISCARD FKShmArenaStats Stats() const {
+    FKShmArenaStats s{};
+    fk_shm_arena_stats(m_Arena, &s);
+    return s;
+  }
+
+private:
+  FKShmHandle       m_Handle = nullptr;
+  FKShmArenaHeader* m_Arena = nullptr;
+};
+
+} // namespace FrameKit::SHM
+#endif // __cplusplus
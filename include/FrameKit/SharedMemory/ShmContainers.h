@@ -0,0 +1,358 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/SharedMemory/ShmContainers.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Containers whose storage comes from a ShmArena, so a whole structure
+//      can be built by one process and walked by another:
+//
+//        String          bytes + size, always NUL-terminated
+//        Vector<T>       contiguous, grows by moving elements to a new block
+//        Map<K, V>       sorted flat map on a Vector; lookups take anything
+//                        comparable with K (e.g. std::string_view for String)
+//
+//      Links are OffsetPtrs, so a container is only visible to other processes
+//      while it lives inside the arena (e.g. under the root object); one on a
+//      process's stack works but is private to it. Operations that allocate
+//      report exhaustion through their return value and leave the container
+//      unchanged. There is no internal locking: share structures that are
+//      built once, or guard them with the caller's own synchronization.
+//
+//      Elements are moved with their move operations, never memcpy'd, so they
+//      may hold OffsetPtrs themselves (Map<String, Vector<int>> is fine).
+//      Types that need the arena take FKShmArenaHeader* as their first
+//      constructor argument; Vector/Map pass it along automatically.
+// =============================================================================
+#pragma once
+
+#include "FrameKit/SharedMemory/ShmArena.h"
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace FrameKit::SHM {
+
+namespace detail {
+  // T wants the arena in front of args (copies and moves never do)
+  template <class T, class... Args>
+  constexpr bool takes_arena = std::is_constructible_v<T, FKShmArenaHeader*, Args...> &&
+    !(sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, T> && ...));
+
+  // Construct T in place, handing it the arena if it wants one
+  template <class T, class... Args>
+  T* construct_in(void* p, FKShmArenaHeader* arena, Args&&... args) {
+    if constexpr (takes_arena<T, Args...>)
+      return new (p) T(arena, std::forward<Args>(args)...);
+    else
+      return new (p) T(std::forward<Args>(args)...);
+  }
+
+  template <class T, class... Args>
+  T make_in(FKShmArenaHeader* arena, Args&&... args) {
+    if constexpr (takes_arena<T, Args...>)
+      return T(arena, std::forward<Args>(args)...);
+    else
+      return T(std::forward<Args>(args)...);
+  }
+
+  // Give `dst` the value of `src`; false when that needed memory and the arena had none
+  template <class T, class Q>
+  bool assign_from(T& dst, const Q& src) {
+    if constexpr (requires { { dst.Assign(src) } -> std::same_as<bool>; }) return dst.Assign(src);
+    else { dst = src; return true; }
+  }
+}
+
+// ---- String -----------------------------------------------------------------
+class String {
+public:
+  explicit String(FKShmArenaHeader* arena) noexcept : m_Arena(arena) {}
+  ~String() { fk_shm_arena_free(m_Arena.Get(), m_Data.Get()); }
+
+  String(String&& o) noexcept
+    : m_Arena(o.m_Arena), m_Data(o.m_Data),
+      m_Size(std::exchange(o.m_Size, 0)), m_Capacity(std::exchange(o.m_Capacity, 0)) {
+    o.m_Data = nullptr;
+  }
+  String& operator=(String&& o) noexcept {
+    if (this != &o) {
+      fk_shm_arena_free(m_Arena.Get(), m_Data.Get());
+      m_Arena = o.m_Arena;
+      m_Data = o.m_Data;
+      m_Size = std::exchange(o.m_Size, 0);
+      m_Capacity = std::exchange(o.m_Capacity, 0);
+      o.m_Data = nullptr;
+    }
+    return *this;
+  }
+  // Copies would need to allocate; use Assign
+  String(const String&) = delete;
+  String& operator=(const String&) = delete;
+
+  bool Reserve(uint64_t capacity) {
+    char* old = m_Data.Get();
+    if (!Grow(capacity)) return false;
+    if (old != m_Data.Get()) fk_shm_arena_free(m_Arena.Get(), old);
+    return true;
+  }
+
+  bool Assign(std::string_view s) {
+    // The old buffer is freed only after copying, in case s points into it
+    char* old = m_Data.Get();
+    if (s.size() > m_Capacity) {
+      const uint64_t size = std::exchange(m_Size, 0);   // old contents need no copy
+      if (!Grow(s.size())) { m_Size = size; return false; }
+    }
+    if (!s.empty()) std::memmove(m_Data.Get(), s.data(), s.size());
+    m_Size = s.size();
+    if (m_Data) m_Data.Get()[m_Size] = '\0';   // no buffer yet (empty s): CStr() is ""
+    if (old != m_Data.Get()) fk_shm_arena_free(m_Arena.Get(), old);
+    return true;
+  }
+  bool Assign(const String& s) { return this == &s || Assign(s.View()); }
+
+  bool Append(std::string_view s) {
+    if (s.empty()) return true;
+    char* old = m_Data.Get();
+    if (m_Size + s.size() > m_Capacity && !Grow(std::max(m_Size + s.size(), 2 * m_Capacity))) return false;
+    std::memcpy(m_Data.Get() + m_Size, s.data(), s.size());
+    m_Size += s.size();
+    m_Data.Get()[m_Size] = '\0';
+    if (old != m_Data.Get()) fk_shm_arena_free(m_Arena.Get(), old);
+    return true;
+  }
+
+  void Clear() noexcept {
+    m_Size = 0;
+    if (m_Data) m_Data.Get()[0] = '\0';
+  }
+
+  FK_NODISCARD std::string_view View() const noexcept { return { CStr(), static_cast<size_t>(m_Size) }; }
+  FK_NODISCARD const char* CStr() const noexcept { return m_Data ? m_Data.Get() : ""; }
+  FK_NODISCARD uint64_t Size() const noexcept { return m_Size; }
+  FK_NODISCARD bool Empty() const noexcept { return m_Size == 0; }
+  FK_NODISCARD FKShmArenaHeader* Arena() const noexcept { return m_Arena.Get(); }
+
+  operator std::string_view() const noexcept { return View(); }
+
+  friend bool operator==(const String& a, const String& b) noexcept { return a.View() == b.View(); }
+  friend bool operator==(const String& a, std::string_view b) noexcept { return a.View() == b; }
+  friend std::strong_ordering operator<=>(const String& a, const String& b) noexcept { return a.View() <=> b.View(); }
+  friend std::strong_ordering operator<=>(const String& a, std::string_view b) noexcept { return a.View() <=> b; }
+
+private:
+  // Switch to a buffer holding `capacity` chars plus the terminator, keeping
+  // the contents; the caller frees the old one.
+  bool Grow(uint64_t capacity) {
+    if (capacity <= m_Capacity) return true;
+    auto* p = static_cast<char*>(fk_shm_arena_alloc(m_Arena.Get(), static_cast<size_t>(capacity + 1)));
+    if (!p) return false;
+    if (m_Size) std::memcpy(p, m_Data.Get(), m_Size);
+    p[m_Size] = '\0';
+    m_Data = p;
+    m_Capacity = fk_shm_arena_block_size(m_Arena.Get(), p) - 1;
+    return true;
+  }
+
+  OffsetPtr<FKShmArenaHeader> m_Arena;
+  OffsetPtr<char>             m_Data;
+  uint64_t                    m_Size = 0;
+  uint64_t                    m_Capacity = 0;   // excluding the terminator
+};
+
+// ---- Vector -----------------------------------------------------------------
+template <class T>
+class Vector {
+  static_assert(alignof(T) <= 16, "arena blocks are 16-byte aligned");
+  static_assert(std::is_nothrow_move_constructible_v<T>, "elements are moved when the vector grows");
+
+public:
+  explicit Vector(FKShmArenaHeader* arena) noexcept : m_Arena(arena) {}
+  ~Vector() { Release(); }
+
+  Vector(Vector&& o) noexcept
+    : m_Arena(o.m_Arena), m_Data(o.m_Data),
+      m_Size(std::exchange(o.m_Size, 0)), m_Capacity(std::exchange(o.m_Capacity, 0)) {
+    o.m_Data = nullptr;
+  }
+  Vector& operator=(Vector&& o) noexcept {
+    if (this != &o) {
+      Release();
+      m_Arena = o.m_Arena;
+      m_Data = o.m_Data;
+      m_Size = std::exchange(o.m_Size, 0);
+      m_Capacity = std::exchange(o.m_Capacity, 0);
+      o.m_Data = nullptr;
+    }
+    return *this;
+  }
+  Vector(const Vector&) = delete;
+  Vector& operator=(const Vector&) = delete;
+
+  bool Reserve(uint64_t capacity) { return capacity <= m_Capacity || Regrow(capacity, m_Size, nullptr); }
+
+  // Construct at the end (the arena is passed first if T takes it). nullptr when out of memory.
+  template <class... Args>
+  T* EmplaceBack(Args&&... args) { return EmplaceAt(m_Size, std::forward<Args>(args)...); }
+  bool PushBack(T&& v) { return EmplaceBack(std::move(v)) != nullptr; }
+  bool PushBack(const T& v) requires std::is_copy_constructible_v<T> { return EmplaceBack(v) != nullptr; }
+
+  // Construct at index (<= Size()), shifting later elements up
+  template <class... Args>
+  T* EmplaceAt(uint64_t index, Args&&... args) {
+    if (index > m_Size) return nullptr;
+    if (m_Size == m_Capacity) {
+      // Build the new element first: args may refer to elements of this vector
+      T* slot = nullptr;
+      auto make = [&](T* at) { slot = detail::construct_in<T>(at, m_Arena.Get(), std::forward<Args>(args)...); };
+      return Regrow(std::max<uint64_t>(4, 2 * m_Capacity), index, make) ? slot : nullptr;
+    }
+    T* d = Data();
+    if (index == m_Size) {
+      detail::construct_in<T>(d + m_Size, m_Arena.Get(), std::forward<Args>(args)...);
+    } else {
+      T tmp = detail::make_in<T>(m_Arena.Get(), std::forward<Args>(args)...);
+      new (d + m_Size) T(std::move(d[m_Size - 1]));
+      std::move_backward(d + index, d + m_Size - 1, d + m_Size);
+      d[index] = std::move(tmp);
+    }
+    ++m_Size;
+    return d + index;
+  }
+
+  void PopBack() noexcept {
+    if (m_Size) std::destroy_at(Data() + --m_Size);
+  }
+  void EraseAt(uint64_t index) noexcept {
+    if (index >= m_Size) return;
+    T* d = Data();
+    std::move(d + index + 1, d + m_Size, d + index);
+    std::destroy_at(d + --m_Size);
+  }
+  void Clear() noexcept {
+    std::destroy_n(Data(), m_Size);
+    m_Size = 0;
+  }
+
+  FK_NODISCARD T* Data() const noexcept { return m_Data.Get(); }
+  FK_NODISCARD uint64_t Size() const noexcept { return m_Size; }
+  FK_NODISCARD uint64_t Capacity() const noexcept { return m_Capacity; }
+  FK_NODISCARD bool Empty() const noexcept { return m_Size == 0; }
+  FK_NODISCARD FKShmArenaHeader* Arena() const noexcept { return m_Arena.Get(); }
+
+  T& operator[](uint64_t i) const noexcept { return Data()[i]; }
+  T& Back() const noexcept { return Data()[m_Size - 1]; }
+  T* begin() const noexcept { return Data(); }
+  T* end() const noexcept { return Data() + m_Size; }
+
+private:
+  // Move into a block for `capacity` elements, leaving a gap at `gap` filled by
+  // make(slot) when given. The block's size class may allow more than asked.
+  template <class Make>
+  bool Regrow(uint64_t capacity, uint64_t gap, Make&& make) {
+    const uint64_t bytes = capacity * sizeof(T);
+    if (bytes / sizeof(T) != capacity) return false;
+    auto* fresh = static_cast<T*>(fk_shm_arena_alloc(m_Arena.Get(), static_cast<size_t>(bytes)));
+    if (!fresh) return false;
+    constexpr bool gapped = !std::is_same_v<std::decay_t<Make>, std::nullptr_t>;
+    if constexpr (gapped) make(fresh + gap);
+    T* old = Data();
+    std::uninitialized_move(old, old + gap, fresh);
+    std::uninitialized_move(old + gap, old + m_Size, fresh + gap + (gapped ? 1 : 0));
+    std::destroy_n(old, m_Size);
+    fk_shm_arena_free(m_Arena.Get(), old);
+    m_Data = fresh;
+    m_Capacity = fk_shm_arena_block_size(m_Arena.Get(), fresh) / sizeof(T);
+    if constexpr (gapped) ++m_Size;
+    return true;
+  }
+
+  void Release() noexcept {
+    Clear();
+    fk_shm_arena_free(m_Arena.Get(), m_Data.Get());
+    m_Data = nullptr;
+    m_Capacity = 0;
+  }
+
+  OffsetPtr<FKShmArenaHeader> m_Arena;
+  OffsetPtr<T>                m_Data;
+  uint64_t                    m_Size = 0;
+  uint64_t                    m_Capacity = 0;
+};
+
+// ---- Map --------------------------------------------------------------------
+template <class K, class V>
+class Map {
+public:
+  struct Entry {
+    K key;
+    V value;
+
+    template <class... Args>
+    Entry(FKShmArenaHeader* arena, Args&&... args)
+      : key(detail::make_in<K>(arena)), value(detail::make_in<V>(arena, std::forward<Args>(args)...)) {}
+    Entry(Entry&&) noexcept = default;
+    Entry& operator=(Entry&&) noexcept = default;
+  };
+
+  explicit Map(FKShmArenaHeader* arena) noexcept : m_Entries(arena) {}
+
+  template <class Q>
+  FK_NODISCARD V* Find(const Q& key) const noexcept {
+    const uint64_t i = LowerBound(key);
+    return i < m_Entries.Size() && m_Entries[i].key == key ? &m_Entries[i].value : nullptr;
+  }
+  template <class Q>
+  FK_NODISCARD bool Contains(const Q& key) const noexcept { return Find(key) != nullptr; }
+
+  // Existing value for key, or a new one built from args. nullptr when out of memory.
+  template <class Q, class... Args>
+  V* Emplace(const Q& key, Args&&... args) {
+    const uint64_t i = LowerBound(key);
+    if (i < m_Entries.Size() && m_Entries[i].key == key) return &m_Entries[i].value;
+    Entry e(m_Entries.Arena(), std::forward<Args>(args)...);
+    if (!detail::assign_from(e.key, key)) return nullptr;
+    Entry* slot = m_Entries.EmplaceAt(i, std::move(e));
+    return slot ? &slot->value : nullptr;
+  }
+
+  template <class Q>
+  bool Erase(const Q& key) noexcept {
+    const uint64_t i = LowerBound(key);
+    if (i >= m_Entries.Size() || !(m_Entries[i].key == key)) return false;
+    m_Entries.EraseAt(i);
+    return true;
+  }
+
+  void Clear() noexcept { m_Entries.Clear(); }
+  bool Reserve(uint64_t n) { return m_Entries.Reserve(n); }
+
+  FK_NODISCARD uint64_t Size() const noexcept { return m_Entries.Size(); }
+  FK_NODISCARD bool Empty() const noexcept { return m_Entries.Empty(); }
+
+  // Entries in key order
+  Entry* begin() const noexcept { return m_Entries.begin(); }
+  Entry* end() const noexcept { return m_Entries.end(); }
+
+private:
+  template <class Q>
+  uint64_t LowerBound(const Q& key) const noexcept {
+    return static_cast<uint64_t>(std::lower_bound(begin(), end(), key,
+      [](const Entry& e, const Q& k) { return e.key < k; }) - begin());
+  }
+
+  Vector<Entry> m_Entries;
+};
+
+} // namespace FrameKit::SHM
@@ -0,0 +1,84 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/SharedMemory/ShmEvent.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Cross-process wait/notify for state kept in an fk_shm payload. An
+//      FKShmEvent is an event count placed inside the mapping: waiters
+//      register, re-check their condition, then spin briefly and park on the
+//      event word (Linux: a shared futex); notifiers only make a system call
+//      when someone is parked or about to park.
+//
+//      Waiter:                              Notifier:
+//        key = fk_shm_event_prepare_wait(e)   publish state
+//        if (condition) cancel_wait(e)        fk_shm_event_notify_all(e)
+//        else fk_shm_event_wait(e, key, ms)
+//
+//      Zero-filled is a valid event. Windows has no cross-process futex, so
+//      it falls back to polling the event word with short sleeps.
+// =============================================================================
+#pragma once
+
+#include "FrameKit/SharedMemory/SharedMemory.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Shared layout (place inside the mapping) -------------------------------
+typedef struct FKShmEvent {
+  uint32_t epoch;     // bumped by notifies that find waiters; the futex word
+  uint32_t waiters;   // registered waiters (a crashed waiter only costs extra wakes)
+} FKShmEvent;
+
+// ---- C API ------------------------------------------------------------------
+
+// Register as a waiter and return the key to pass to fk_shm_event_wait.
+// Check the condition after this call, not before, or a notify can be missed.
+FK_SHM_API uint32_t fk_shm_event_prepare_wait(FKShmEvent* ev);
+// Unregister without waiting (the condition turned out to be true).
+FK_SHM_API void     fk_shm_event_cancel_wait(FKShmEvent* ev);
+// Block until a notify after prepare_wait, or timeout_ms (< 0 waits forever).
+// Unregisters. FKSHM_OK when notified (or spuriously woken), FKSHM_ERR_TIMEOUT otherwise.
+FK_SHM_API int      fk_shm_event_wait(FKShmEvent* ev, uint32_t key, int timeout_ms);
+
+// Wake waiters. Without registered waiters this is a fence and a load.
+FK_SHM_API void     fk_shm_event_notify_one(FKShmEvent* ev);
+FK_SHM_API void     fk_shm_event_notify_all(FKShmEvent* ev);
+
+#ifdef __cplusplus
+} // extern "C"
+
+#include <chrono>
+
+// ---- C++ sugar --------------------------------------------------------------
+namespace FrameKit::SHM {
+
+// Wait until pred() holds or timeoutMs passes (< 0 waits forever).
+// Returns the final pred() result.
+template <class Pred>
+inline bool WaitUntil(FKShmEvent& ev, Pred&& pred, int timeoutMs = -1) {
+  using Clock = std::chrono::steady_clock;
+  const auto deadline = Clock::now() + std::chrono::milliseconds(timeoutMs < 0 ? 0 : timeoutMs);
+  for (;;) {
+    if (pred()) return true;
+    const uint32_t key = fk_shm_event_prepare_wait(&ev);
+    if (pred()) { fk_shm_event_cancel_wait(&ev); return true; }
+    int waitMs = -1;
+    if (timeoutMs >= 0) {
+      const auto left = std::chrono::ceil<std::chrono::milliseconds>(deadline - Clock::now()).count();
+      if (left <= 0) { fk_shm_event_cancel_wait(&ev); return pred(); }
+      waitMs = static_cast<int>(left);
+    }
+    fk_shm_event_wait(&ev, key, waitMs);
+  }
+}
+
+} // namespace FrameKit::SHM
+#endif // __cplusplus
@@ -0,0 +1,143 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/SharedMemory/ShmMpmcQueue.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Bounded multi-producer/multi-consumer queue inside an fk_shm segment
+//      (Vyukov-style: every slot carries a sequence number, so producers and
+//      consumers only contend on their own cursor). Messages are copied into
+//      fixed-size slots of up to max_message bytes.
+//
+//      A process that dies between claiming a slot and finishing with it
+//      would wedge the queue. Taking a slot atomically records the owner's
+//      pid in it; when a slot stays stuck and its owner is gone (or the slot
+//      was never taken within the abandon timeout after its position was
+//      claimed) the next process to reach it skips it and counts it in
+//      `abandoned`. A live owner's slot is never taken away.
+// =============================================================================
+#pragma once
+
+#include "FrameKit/SharedMemory/SharedMemory.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Opaque handle ----------------------------------------------------------
+typedef struct FKShmMpmcQueue_t* FKShmMpmcQueue;
+
+// ---- Occupancy statistics (shared by every process using the queue) --------
+typedef struct FKShmMpmcStats {
+  uint64_t capacity;     // slots
+  uint64_t size;         // messages currently queued (approximate)
+  uint64_t highWater;    // largest size seen by producers (sampled)
+  uint64_t enqueued;     // slots claimed by producers
+  uint64_t dequeued;     // slots claimed by consumers
+  uint64_t fullRejects;  // enqueues that found the queue full
+  uint64_t abandoned;    // slots skipped because their owner died mid-operation
+} FKShmMpmcStats;
+
+// ---- C API ------------------------------------------------------------------
+
+// Create or open the queue `name` with `slot_count` slots (power of two) of
+// `max_message` bytes each. All processes must pass the same geometry.
+FK_SHM_API int fk_shm_mpmc_create_or_open(const char*    name,
+                                          size_t         slot_count,
+                                          size_t         max_message,
+                                          FKShmOpenMode  mode,
+                                          FKShmMpmcQueue* out_queue,
+                                          int*           out_created);
+
+// Close the handle; the segment stays until fk_shm_unlink(name). Safe with NULL.
+FK_SHM_API void fk_shm_mpmc_close(FKShmMpmcQueue queue);
+
+// How long a claimed slot may stay unfinished with no owner recorded before
+// it is treated as abandoned (default 1000 ms). Per handle.
+FK_SHM_API void fk_shm_mpmc_set_abandon_timeout(FKShmMpmcQueue queue, uint32_t ms);
+
+// Non-blocking. FKSHM_ERR_FULL / FKSHM_ERR_EMPTY when nothing can be done now;
+// FKSHM_ERR_TOO_LARGE if len > max_message (enqueue) or the message does not
+// fit in cap (dequeue; *out_len is set and the message is lost).
+// A caller that stalls past the abandon timeout between claiming a position
+// and taking its slot may find the position given up on; it then gets
+// FKSHM_ERR_SYS without touching the slot, and the message is dropped.
+FK_SHM_API int fk_shm_mpmc_try_enqueue(FKShmMpmcQueue queue, const void* data, size_t len);
+FK_SHM_API int fk_shm_mpmc_try_dequeue(FKShmMpmcQueue queue, void* buf, size_t cap, size_t* out_len);
+
+// Blocking with a timeout in milliseconds (< 0 waits forever); parks on a
+// shared ShmEvent between attempts. FKSHM_ERR_TIMEOUT when the time runs out.
+FK_SHM_API int fk_shm_mpmc_enqueue(FKShmMpmcQueue queue, const void* data, size_t len, int timeout_ms);
+FK_SHM_API int fk_shm_mpmc_dequeue(FKShmMpmcQueue queue, void* buf, size_t cap, size_t* out_len, int timeout_ms);
+
+FK_SHM_API int fk_shm_mpmc_stats(FKShmMpmcQueue queue, FKShmMpmcStats* out_stats);
+
+#ifdef __cplusplus
+} // extern "C"
+
+#include <type_traits>
+#include <utility>
+
+// ---- C++ wrapper ------------------------------------------------------------
+namespace FrameKit::SHM {
+
+// One T per slot; T is copied bytewise so it must not hold pointers into a
+// process's own address space.
+template <class T>
+class MpmcQueue {
+  static_assert(std::is_trivially_copyable_v<T>, "shared queue elements are copied bytewise");
+
+public:
+  MpmcQueue() = default;
+  ~MpmcQueue() { Close(); }
+  MpmcQueue(MpmcQueue&& o) noexcept : m_Queue(std::exchange(o.m_Queue, nullptr)) {}
+  MpmcQueue& operator=(MpmcQueue&& o) noexcept {
+    if (this != &o) { Close(); m_Queue = std::exchange(o.m_Queue, nullptr); }
+    return *this;
+  }
+  MpmcQueue(const MpmcQueue&) = delete;
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+  // Returns an FKSHM_* code.
+  int Open(const char* name, size_t slotCount, FKShmOpenMode mode, int* outCreated = nullptr) {
+    Close();
+    int created = 0;
+    const int rc = fk_shm_mpmc_create_or_open(name, slotCount, sizeof(T), mode, &m_Queue, &created);
+    if (outCreated) *outCreated = created;
+    return rc;
+  }
+  void Close() { fk_shm_mpmc_close(m_Queue); m_Queue = nullptr; }
+
+  FK_NODISCARD bool IsOpen() const noexcept { return m_Queue != nullptr; }
+
+  bool TryPush(const T& v) { return fk_shm_mpmc_try_enqueue(m_Queue, &v, sizeof(T)) == FKSHM_OK; }
+  bool TryPop(T& v) {
+    size_t len = 0;
+    return fk_shm_mpmc_try_dequeue(m_Queue, &v, sizeof(T), &len) == FKSHM_OK;
+  }
+  bool Push(const T& v, int timeoutMs = -1) { return fk_shm_mpmc_enqueue(m_Queue, &v, sizeof(T), timeoutMs) == FKSHM_OK; }
+  bool Pop(T& v, int timeoutMs = -1) {
+    size_t len = 0;
+    return fk_shm_mpmc_dequeue(m_Queue, &v, sizeof(T), &len, timeoutMs) == FKSHM_OK;
+  }
+
+  FK_NODISCARD FKShmMpmcStats Stats() const {
+    FKShmMpmcStats s{};
+    fk_shm_mpmc_stats(m_Queue, &s);
+    return s;
+  }
+  void SetAbandonTimeout(uint32_t ms) { fk_shm_mpmc_set_abandon_timeout(m_Queue, ms); }
+
+  FK_NODISCARD FKShmMpmcQueue Handle() const noexcept { return m_Queue; }
+
+private:
+  FKShmMpmcQueue m_Queue = nullptr;
+};
+
+} // namespace FrameKit::SHM
+#endif // __cplusplus
@@ -0,0 +1,183 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/SharedMemory/ShmSpscRing.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Lock-free single-producer/single-consumer ring inside an fk_shm
+//      segment, for streaming between processes. One process writes, one
+//      reads; head and tail live on separate cache lines and each side keeps
+//      a private copy of the other's cursor, so the shared lines are only
+//      touched when the cached view runs out.
+//
+//      Two kinds, fixed at creation:
+//        FKSHM_RING_MESSAGES  variable-length records (8-byte aligned,
+//                             at most capacity/2 each), never split
+//        FKSHM_RING_BYTES     a plain byte stream, like a pipe
+//      Writes become visible on commit, reads free space on release, so
+//      batches cost one shared store each. Either side can block until the
+//      other makes progress (ShmEvent: spin, then park on a shared futex);
+//      the wake-up check adds one store-load fence per commit/release.
+// =============================================================================
+#pragma once
+
+#include "FrameKit/SharedMemory/SharedMemory.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- Opaque handle ----------------------------------------------------------
+typedef struct FKShmSpscRing_t* FKShmSpscRing;
+
+typedef enum FKShmRingKind {
+  FKSHM_RING_MESSAGES = 0,
+  FKSHM_RING_BYTES    = 1
+} FKShmRingKind;
+
+// ---- C API ------------------------------------------------------------------
+
+// Create or open the ring `name` with `capacity` data bytes (power of two, >= 64).
+// Both sides must pass the same capacity and kind. Sets *out_created like
+// fk_shm_create_or_open.
+FK_SHM_API int fk_shm_spsc_create_or_open(const char*   name,
+                                          size_t        capacity,
+                                          FKShmRingKind kind,
+                                          FKShmOpenMode mode,
+                                          FKShmSpscRing* out_ring,
+                                          int*          out_created);
+
+// Close the handle; the segment stays until fk_shm_unlink(name). Safe with NULL.
+// Uncommitted writes are dropped; unreleased reads are seen again by the next reader.
+FK_SHM_API void fk_shm_spsc_close(FKShmSpscRing ring);
+
+FK_SHM_API size_t fk_shm_spsc_capacity(FKShmSpscRing ring);
+FK_SHM_API size_t fk_shm_spsc_max_message(FKShmSpscRing ring);   // 0 for byte rings
+FK_SHM_API size_t fk_shm_spsc_used(FKShmSpscRing ring);          // published, unreleased bytes (approximate)
+
+// ---- Messages: producer ----
+// Space for one record of `len` bytes, or NULL when full or too large.
+// Reserved records stay invisible to the consumer until commit.
+FK_SHM_API void* fk_shm_spsc_reserve(FKShmSpscRing ring, size_t len);
+FK_SHM_API void  fk_shm_spsc_commit(FKShmSpscRing ring);
+// reserve + copy + commit. FKSHM_ERR_FULL or FKSHM_ERR_TOO_LARGE on failure.
+FK_SHM_API int   fk_shm_spsc_try_write(FKShmSpscRing ring, const void* data, size_t len);
+
+// ---- Messages: consumer ----
+// Next record in place, or NULL when empty. Stays valid until release.
+FK_SHM_API const void* fk_shm_spsc_read(FKShmSpscRing ring, size_t* out_len);
+FK_SHM_API void        fk_shm_spsc_release(FKShmSpscRing ring);
+// read + copy + release. FKSHM_ERR_EMPTY, or FKSHM_ERR_TOO_LARGE with *out_len
+// set to the record size (the record is left in the ring).
+FK_SHM_API int         fk_shm_spsc_try_read(FKShmSpscRing ring, void* buf, size_t cap, size_t* out_len);
+
+// ---- Bytes ----
+// Copy as much as fits / is available and publish it. Return the byte count.
+FK_SHM_API size_t fk_shm_spsc_write_bytes(FKShmSpscRing ring, const void* data, size_t len);
+FK_SHM_API size_t fk_shm_spsc_read_bytes(FKShmSpscRing ring, void* buf, size_t cap);
+
+// ---- Blocking (timeout_ms < 0 waits forever) ----
+// FKSHM_OK once something can be read, FKSHM_ERR_TIMEOUT otherwise.
+FK_SHM_API int fk_shm_spsc_wait_readable(FKShmSpscRing ring, int timeout_ms);
+// FKSHM_OK once a `len`-byte message (or, for byte rings, min(len, capacity)
+// bytes) fits, FKSHM_ERR_TIMEOUT otherwise.
+FK_SHM_API int fk_shm_spsc_wait_writable(FKShmSpscRing ring, size_t len, int timeout_ms);
+
+#ifdef __cplusplus
+} // extern "C"
+
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// ---- C++ wrapper ------------------------------------------------------------
+namespace FrameKit::SHM {
+
+class SpscRing {
+public:
+  SpscRing() = default;
+  ~SpscRing() { Close(); }
+  SpscRing(SpscRing&& o) noexcept : m_Ring(std::exchange(o.m_Ring, nullptr)) {}
+  SpscRing& operator=(SpscRing&& o) noexcept {
+    if (this != &o) { Close(); m_Ring = std::exchange(o.m_Ring, nullptr); }
+    return *this;
+  }
+  SpscRing(const SpscRing&) = delete;
+  SpscRing& operator=(const SpscRing&) = delete;
+
+  // Returns an FKSHM_* code.
+  int Open(const char* name, size_t capacity, FKShmOpenMode mode,
+           FKShmRingKind kind = FKSHM_RING_MESSAGES, int* outCreated = nullptr) {
+    Close();
+    int created = 0;
+    const int rc = fk_shm_spsc_create_or_open(name, capacity, kind, mode, &m_Ring, &created);
+    if (outCreated) *outCreated = created;
+    return rc;
+  }
+  void Close() { fk_shm_spsc_close(m_Ring); m_Ring = nullptr; }
+
+  FK_NODISCARD bool   IsOpen() const noexcept { return m_Ring != nullptr; }
+  FK_NODISCARD size_t Capacity() const { return fk_shm_spsc_capacity(m_Ring); }
+  FK_NODISCARD size_t MaxMessage() const { return fk_shm_spsc_max_message(m_Ring); }
+  FK_NODISCARD size_t Used() const { return fk_shm_spsc_used(m_Ring); }
+
+  // Producer
+  FK_NODISCARD void* Reserve(size_t len) { return fk_shm_spsc_reserve(m_Ring, len); }
+  void Commit() { fk_shm_spsc_commit(m_Ring); }
+  bool TryWrite(const void* data, size_t len) { return fk_shm_spsc_try_write(m_Ring, data, len) == FKSHM_OK; }
+  template <class T>
+  bool TryPush(const T& v) {
+    static_assert(std::is_trivially_copyable_v<T>, "ring messages are copied bytewise");
+    return TryWrite(&v, sizeof(T));
+  }
+
+  // Consumer
+  FK_NODISCARD const void* Read(size_t& len) { return fk_shm_spsc_read(m_Ring, &len); }
+  void Release() { fk_shm_spsc_release(m_Ring); }
+  template <class T>
+  bool TryPop(T& v) {
+    static_assert(std::is_trivially_copyable_v<T>, "ring messages are copied bytewise");
+    size_t len = 0;
+    const void* p = Read(len);
+    if (!p) return false;
+    std::memcpy(&v, p, len < sizeof(T) ? len : sizeof(T));
+    Release();
+    return true;
+  }
+  // Calls fn(const void* data, size_t len) for up to maxCount records, then
+  // releases them in one store. Returns the number consumed.
+  template <class Fn>
+  size_t ConsumeBatch(Fn&& fn, size_t maxCount = (std::numeric_limits<size_t>::max)()) {
+    size_t n = 0, len = 0;
+    while (n < maxCount) {
+      const void* p = Read(len);
+      if (!p) break;
+      fn(p, len);
+      ++n;
+    }
+    if (n) Release();
+    return n;
+  }
+
+  // Byte stream
+  size_t WriteBytes(const void* data, size_t len) { return fk_shm_spsc_write_bytes(m_Ring, data, len); }
+  size_t ReadBytes(void* buf, size_t cap) { return fk_shm_spsc_read_bytes(m_Ring, buf, cap); }
+
+  // Blocking
+  bool WaitReadable(int timeoutMs = -1) { return fk_shm_spsc_wait_readable(m_Ring, timeoutMs) == FKSHM_OK; }
+  bool WaitWritable(size_t len, int timeoutMs = -1) { return fk_shm_spsc_wait_writable(m_Ring, len, timeoutMs) == FKSHM_OK; }
+
+  FK_NODISCARD FKShmSpscRing Handle() const noexcept { return m_Ring; }
+
+private:
+  FKShmSpscRing m_Ring = nullptr;
+};
+
+} // namespace FrameKit::SHM
+#endif // __cplusplus
@@ -0,0 +1,177 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : include/FrameKit/SharedMemory/ShmStateBlock.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Latest-value sharing across processes: one writer publishes a T,
+//      any number of readers take consistent snapshots without locks.
+//
+//      StateBlock<T>        seqlock; the writer never waits, readers retry
+//                           when a write overlaps their copy. Best for
+//                           small T.
+//      TripleStateBlock<T>  three seqlocked buffers written round-robin;
+//                           a reader is only disturbed if two further
+//                           writes complete while it copies, so large T
+//                           stays readable under frequent updates.
+//
+//      Both live in a mapping as-is, e.g.
+//        auto* pose = SHM::CreateTyped<SHM::StateBlock<Pose>>("fk_pose", FKSHM_OpenOrCreate, &h);
+//      They are cache-line aligned; CreateTyped/OpenTyped place them on a
+//      line boundary. Other placements must do the same.
+//      A zero-filled block is version 0 holding a zero-filled T. Readers can
+//      block until a newer version appears (WaitNewer). One writer at a time;
+//      a writer that dies mid-write leaves that buffer unreadable until the
+//      next write, so the unbounded Read() then never returns. Readers of a
+//      writer that may crash should use TryRead() or Read(out, timeoutMs).
+// =============================================================================
+#pragma once
+
+#include "FrameKit/SharedMemory/SharedMemory.h"
+#include "FrameKit/SharedMemory/ShmEvent.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace FrameKit::SHM {
+
+namespace detail {
+  // Spin, then yield while a write is in progress
+  inline void seqlock_pause(uint32_t attempt) noexcept {
+    if (attempt < 64) FK_CPU_RELAX();
+    else std::this_thread::yield();
+  }
+
+  // Retries tryRead until it succeeds or timeoutMs passes (< 0 waits forever)
+  template <class F>
+  bool seqlock_read(F&& tryRead, int timeoutMs) noexcept {
+    if (tryRead()) return true;
+    if (timeoutMs == 0) return false;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    for (uint32_t attempt = 0; !tryRead(); ++attempt) {
+      if (timeoutMs > 0 && (attempt & 63) == 63 && std::chrono::steady_clock::now() >= deadline) return false;
+      seqlock_pause(attempt);
+    }
+    return true;
+  }
+}
+
+template <class T>
+class StateBlock {
+  static_assert(std::is_trivially_copyable_v<T>, "shared state is copied bytewise");
+
+public:
+  // Writer. Never blocks.
+  void Write(const T& value) noexcept {
+    const uint64_t s = m_Seq.load(std::memory_order_relaxed);
+    m_Seq.store(s + 1, std::memory_order_relaxed);          // odd: write in progress
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&m_Value, &value, sizeof(T));
+    m_Seq.store(s + 2, std::memory_order_release);
+    fk_shm_event_notify_all(&m_Changed);
+  }
+
+  // One attempt; false if a write overlapped the copy.
+  bool TryRead(T& out, uint64_t* version = nullptr) const noexcept {
+    const uint64_t s1 = m_Seq.load(std::memory_order_acquire);
+    if (s1 & 1) return false;
+    std::memcpy(&out, &m_Value, sizeof(T));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_Seq.load(std::memory_order_relaxed) != s1) return false;
+    if (version) *version = s1 / 2;
+    return true;
+  }
+
+  // Retries until a consistent copy is taken. Never returns if the writer
+  // died mid-write; see Read(out, timeoutMs).
+  T Read(uint64_t* version = nullptr) const noexcept {
+    T out;
+    detail::seqlock_read([&] { return TryRead(out, version); }, -1);
+    return out;
+  }
+
+  // Retries for up to timeoutMs (< 0 waits forever); false if no consistent
+  // copy could be taken in time.
+  bool Read(T& out, int timeoutMs, uint64_t* version = nullptr) const noexcept {
+    return detail::seqlock_read([&] { return TryRead(out, version); }, timeoutMs);
+  }
+
+  // Completed writes so far; cheap way to poll for changes.
+  FK_NODISCARD uint64_t Version() const noexcept { return m_Seq.load(std::memory_order_acquire) / 2; }
+
+  // Block until Version() > seen or timeoutMs passes (< 0 waits forever).
+  bool WaitNewer(uint64_t seen, int timeoutMs = -1) {
+    return WaitUntil(m_Changed, [&] { return Version() > seen; }, timeoutMs);
+  }
+
+private:
+  alignas(FK_CACHELINE_SIZE) std::atomic<uint64_t> m_Seq{ 0 };   // 2 * version, odd while writing
+  FKShmEvent m_Changed{};
+  alignas(FK_CACHELINE_SIZE) T m_Value{};
+};
+
+template <class T>
+class TripleStateBlock {
+  static_assert(std::is_trivially_copyable_v<T>, "shared state is copied bytewise");
+
+public:
+  // Writer. Never blocks; fills the buffer after the latest one.
+  void Write(const T& value) noexcept {
+    const uint64_t next = m_Latest.load(std::memory_order_relaxed) + 1;
+    Buffer& b = m_Buffers[next % kBuffers];
+    b.seq.store(2 * next - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&b.value, &value, sizeof(T));
+    b.seq.store(2 * next, std::memory_order_release);
+    m_Latest.store(next, std::memory_order_release);
+    fk_shm_event_notify_all(&m_Changed);
+  }
+
+  // One attempt at the latest version; false if the writer lapped the copy.
+  bool TryRead(T& out, uint64_t* version = nullptr) const noexcept {
+    const uint64_t v = m_Latest.load(std::memory_order_acquire);
+    const Buffer& b = m_Buffers[v % kBuffers];
+    if (b.seq.load(std::memory_order_acquire) != 2 * v) return false;
+    std::memcpy(&out, &b.value, sizeof(T));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (b.seq.load(std::memory_order_relaxed) != 2 * v) return false;
+    if (version) *version = v;
+    return true;
+  }
+
+  T Read(uint64_t* version = nullptr) const noexcept {
+    T out;
+    detail::seqlock_read([&] { return TryRead(out, version); }, -1);
+    return out;
+  }
+
+  bool Read(T& out, int timeoutMs, uint64_t* version = nullptr) const noexcept {
+    return detail::seqlock_read([&] { return TryRead(out, version); }, timeoutMs);
+  }
+
+  FK_NODISCARD uint64_t Version() const noexcept { return m_Latest.load(std::memory_order_acquire); }
+
+  bool WaitNewer(uint64_t seen, int timeoutMs = -1) {
+    return WaitUntil(m_Changed, [&] { return Version() > seen; }, timeoutMs);
+  }
+
+private:
+  static constexpr uint64_t kBuffers = 3;
+
+  struct Buffer {
+    alignas(FK_CACHELINE_SIZE) std::atomic<uint64_t> seq{ 0 };   // 2 * version stored here, odd while writing
+    alignas(FK_CACHELINE_SIZE) T value{};
+  };
+
+  alignas(FK_CACHELINE_SIZE) std::atomic<uint64_t> m_Latest{ 0 };  // last completed version
+  FKShmEvent m_Changed{};
+  Buffer m_Buffers[kBuffers];
+};
+
+} // namespace FrameKit::SHM
@@ -3,7 +3,7 @@
 // File         : include/FrameKit/Utilities/Time.h
 // Author       : George Gil
 // Created      : 2025-09-07
-// Updated      : 2025-09-09
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Duration type, stopwatch, and engine clock.
 // =============================================================================
@@ -89,4 +89,11 @@ namespace FrameKit {
     // Sleep helper.
     void Sleep(Timestep dt) noexcept;
 
+    // Precise wait on an absolute steady_clock deadline: OS sleep until
+    // `spinWindow` before the deadline, then yield/spin the rest. Returns how
+    // late the OS sleep phase woke up relative to its own target (>= 0), which
+    // callers can use to size the spin window.
+    std::chrono::nanoseconds SleepUntil(std::chrono::steady_clock::time_point deadline,
+                                        std::chrono::nanoseconds spinWindow) noexcept;
+
 } // namespace FrameKit
@@ -3,7 +3,7 @@
 // File         : include/FrameKit/Window/IWindow.h
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Window abstraction and backend registry
 // =============================================================================
@@ -67,6 +67,15 @@ namespace FrameKit {
         virtual void setCursorMode(CursorMode m) = 0;
 
         virtual void Swap() {}
+
+        // Added in window plugin ABI 2; new virtuals go last to keep the
+        // existing slots where older backends expect them.
+        // Blocks until events arrive or `timeoutSeconds` elapse (< 0 => no timeout),
+        // then processes them like poll(). Returns false only on a plain timeout.
+        // Backends without a wait primitive just poll and report activity.
+        virtual bool waitEvents(double /*timeoutSeconds*/) { poll(); return true; }
+        // Wakes a thread blocked in waitEvents(). Safe to call from any thread.
+        virtual void postEmptyEvent() {}
         
         using KeyCallback = void(*)(const RawKeyEvent&);
         using MouseBtnCb = void(*)(const RawMouseBtn&);
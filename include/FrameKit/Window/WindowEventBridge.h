@@ -3,55 +3,86 @@
 // File         : include/FrameKit/Window/WindowEventBridge.h
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
-// Description  : Binds window events to global event handler
+// Description  : Binds window events to global event handler (posted, so they are
+//                queued in deferred mode and delivered by the host's per-frame drain)
+//                Optionally coalesces runs of cursor moves and wheel updates into a
+//                single event; pending input is flushed before any other event and
+//                by the host once per frame, so ordering is preserved.
 // =============================================================================
 
 #pragma once
 
 #include "FrameKit/Window/IWindow.h"
-#include "FrameKit/Events/WindowEvent.h"
-#include "FrameKit/Events/KeyEvent.h"
-#include "FrameKit/Events/MouseEvent.h"
 #include "FrameKit/Events/GlobalEventHandler.h"
+#include "FrameKit/Events/MouseEvent.h"
 #include "FrameKit/Input/KeyCodes.h"
 #include "FrameKit/Input/MouseCodes.h"
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 namespace FrameKit {
 
 inline KeyCode   ToKeyCodeFromRaw(int raw)   { return static_cast<KeyCode>(raw); }   // GLFW path: identical
 inline MouseCode ToMouseCodeFromRaw(int raw) { return static_cast<MouseCode>(raw); } // GLFW path: identical
 
-inline void BindWindowToGlobalEvents(IWindow& w) {
-    w.onCloseReq = [](const CloseReq&) {
-        WindowCloseEvent e; GlobalEventHandler::Get().Emit(e);
-    };
-    w.onResize = [](const Resize& r) {
-        WindowResizeEvent e(static_cast<uint32_t>(r.width), static_cast<uint32_t>(r.height));
-        GlobalEventHandler::Get().Emit(e);
-    };
-    w.onKey = [](const RawKeyEvent& k) {
-        KeyCode kc = ToKeyCodeFromRaw(k.key);
-        if (k.action == 1) {
-            KeyPressedEvent e(kc, k.scancode, k.mods, false); GlobalEventHandler::Get().Emit(e);
-        } else if (k.action == 2) {
-            KeyPressedEvent e(kc, k.scancode, k.mods, true);  GlobalEventHandler::Get().Emit(e);
-        } else {
-            KeyReleasedEvent e(kc, k.scancode, k.mods);       GlobalEventHandler::Get().Emit(e);
-        }
-    };
-    w.onMouseBtn = [](const RawMouseBtn& b) {
-        MouseCode mb = ToMouseCodeFromRaw(b.button);
-        if (b.action) { MouseButtonPressedEvent e(mb);  GlobalEventHandler::Get().Emit(e); }
-        else          { MouseButtonReleasedEvent e(mb); GlobalEventHandler::Get().Emit(e); }
-    };
-    w.onMouseMove = [](const RawMouseMove& m) {
-        MouseMovedEvent e(static_cast<float>(m.x), static_cast<float>(m.y)); GlobalEventHandler::Get().Emit(e);
-    };
-    w.onMouseWheel = [](const RawMouseWheel& v) {
-        MouseScrolledEvent e(static_cast<float>(v.dx), static_cast<float>(v.dy)); GlobalEventHandler::Get().Emit(e);
+// Posts every window callback as-is (no coalescing)
+void BindWindowToGlobalEvents(IWindow& w);
+
+// Sees each window input event right before the bridge posts it (on the
+// thread that polls the window). Events posted by anything else never reach
+// the tap. Empty delegate removes it.
+void SetWindowInputTap(EventDelegate tap) noexcept;
+
+class WindowEventBridge {
+public:
+    struct Settings {
+        bool coalesceMouseMove = false;
+        bool coalesceScroll = false;
+        bool keepMoveHistory = false;   // raw positions, see MouseMovedEvent::GetHistory
     };
-}
+
+    WindowEventBridge() = default;
+    ~WindowEventBridge();
+    WindowEventBridge(const WindowEventBridge&) = delete;
+    WindowEventBridge& operator=(const WindowEventBridge&) = delete;
+
+    // Window callbacks carry no user pointer, so one bridge is bound at a time;
+    // binding another one detaches the previous bridge.
+    void Bind(IWindow& w, const Settings& s);
+
+    // Posts the pending coalesced move/scroll, in arrival order. The host calls
+    // this after polling, before draining the event queue.
+    void Flush();
+
+    FK_NODISCARD std::uint64_t RawMoveCount() const noexcept { return m_RawMoves; }
+    FK_NODISCARD std::uint64_t RawScrollCount() const noexcept { return m_RawScrolls; }
+
+private:
+    void OnMouseMove(const RawMouseMove& m);
+    void OnMouseWheel(const RawMouseWheel& v);
+    void FlushMove();
+    void FlushScroll();
+
+private:
+    Settings      m_Settings{};
+
+    // Pending move
+    std::uint32_t m_MoveCount = 0;
+    float         m_MoveX = 0.0f, m_MoveY = 0.0f;
+    std::shared_ptr<std::vector<MouseMoveSample>> m_MoveHistory;
+
+    // Pending scroll
+    std::uint32_t m_ScrollCount = 0;
+    float         m_ScrollDx = 0.0f, m_ScrollDy = 0.0f;
+
+    bool          m_MoveFirst = true;    // which pending kind arrived first
+
+    std::uint64_t m_RawMoves = 0;
+    std::uint64_t m_RawScrolls = 0;
+};
 
 } // namespace FrameKit
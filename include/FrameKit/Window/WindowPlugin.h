@@ -3,7 +3,7 @@
 // File         : include/FrameKit/Window/WindowPlugin.h
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-11
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Window backend plugin interface
 // =============================================================================
@@ -16,7 +16,8 @@
 extern "C" {
 #endif
 
-#define FRAMEKIT_WINDOW_PLUGIN_ABI 1
+// 2: IWindow gained waitEvents()/postEmptyEvent(); ABI 1 plugins are rejected
+#define FRAMEKIT_WINDOW_PLUGIN_ABI 2
 
     typedef struct FrameKit_WindowDescC {
         const char* title;
@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Core/Addon/AddonManager.cpp
 // Author       : George Gil
 // Created      : 2025-09-20
-// Updated      : 2025-10-08
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : 
 //        Manager implementation: scan, load, tick, unload, host iface registry.
@@ -11,6 +11,7 @@
 
 #include "FrameKit/Addon/AddonManager.h"
 #include "FrameKit/Debug/Log.h"
+#include "FrameKit/Debug/Instrumentor.h"
 #include <algorithm>
 #include <string_view>
 
@@ -46,11 +47,13 @@ namespace FrameKit {
                 items_.push_back(*ld);
             }
         }
+        FK_PROFILE_COUNTER("Addons", items_.size());
     }
 
     void AddonManager::UnloadAll() {
         for (auto& a : items_) loader_.Unload(a);
         items_.clear();
+        FK_PROFILE_COUNTER("Addons", 0);
     }
 
     // --- per-file ops ---------------------------------------------------------
@@ -68,6 +71,7 @@ namespace FrameKit {
         if (auto ld = loader_.Load(p)) {
             policy_.OnAddonLoaded(*ld);
             items_.push_back(*ld);
+            FK_PROFILE_COUNTER("Addons", items_.size());
             return true;
         }
         return false;
@@ -81,6 +85,7 @@ namespace FrameKit {
         if (it == items_.end()) return false;
         loader_.Unload(*it);
         items_.erase(it);
+        FK_PROFILE_COUNTER("Addons", items_.size());
         return true;
     }
 
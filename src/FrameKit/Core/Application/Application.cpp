@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Application/Application.cpp
 // Author       : George Gil
 // Created      : 2025-09-07
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
 //      Default Application overrides for update, render, and event dispatch.
@@ -11,46 +11,62 @@
 // =============================================================================
 
 #include "FrameKit/Application/Application.h"
+#include "FrameKit/Core/Engine/LayerGraph.h"
 #include "FrameKit/Core/Engine/LayerStack.h"
 #include "FrameKit/Debug/Log.h"
 
 namespace FrameKit {
-	bool Application::OnUpdate(Timestep ts) {
-		std::scoped_lock<std::mutex> lock(m_LayerStackMutex);
+	Application::Application()
+		: m_UpdateGraph(std::make_unique<LayerGraph>()) {
+	}
+
+	Application::Application(const ApplicationSpecification& spec)
+		: ApplicationBase(spec), m_UpdateGraph(std::make_unique<LayerGraph>()) {
+	}
+
+	Application::~Application() = default;
 
+	bool Application::OnUpdate(Timestep ts) {
 		if (!m_LayerStack) {
 			FK_CORE_WARN("OnUpdate skipped: LayerStack is null");
 			return true;
 		}
 
-		size_t idx = 0;
-		FK_CORE_TRACE("OnUpdate begin: layers={} dt={} ms", m_LayerStack->Size(), ts.Milliseconds());
+		// Lock-free: the snapshot keeps its layers alive until we drop it
+		const LayerStack::SnapshotPtr snap = m_LayerStack->Acquire();
+		FK_CORE_TRACE("OnUpdate begin: layers={} v{} dt={} ms", snap->Size(), snap->version, ts.Milliseconds());
 
-		for (Layer* layer : *m_LayerStack) {
-			if (!layer) {
-				FK_CORE_WARN("OnUpdate: layer[{}] is null", idx++);
-				continue;
-			}
-			layer->OnSyncUpdate(ts);
-			FK_CORE_TRACE("OnUpdate: layer[{}] updated", idx++);
+		for (size_t idx = 0; idx < snap->layers.size(); ++idx) {
+			if (!snap->layers[idx]) FK_CORE_WARN("OnUpdate: layer[{}] is null", idx);
 		}
 
-		FK_CORE_TRACE("OnUpdate end");
+		// Cached; only rebuilt when the stack or a layer's declarations change
+		m_UpdateGraph->Update(snap->layers, snap->version);
+		m_UpdateGraph->Run(&Layer::OnSyncUpdate, ts);
+
+		FK_CORE_TRACE("OnUpdate end: parallel={}", m_UpdateGraph->IsParallel());
 		return true;
 	}
 
-	void Application::OnRender() {
-		std::scoped_lock<std::mutex> lock(m_LayerStackMutex);
+	void Application::OnFixedUpdate(Timestep fixedTs) {
+		if (!m_LayerStack) return;
 
+		const LayerStack::SnapshotPtr snap = m_LayerStack->Acquire();
+		m_UpdateGraph->Update(snap->layers, snap->version);
+		m_UpdateGraph->Run(&Layer::OnFixedUpdate, fixedTs);
+	}
+
+	void Application::OnRender() {
 		if (!m_LayerStack) {
 			FK_CORE_WARN("OnRender skipped: LayerStack is null");
 			return;
 		}
 
-		FK_CORE_TRACE("OnRender begin: layers={}", m_LayerStack->Size());
+		const LayerStack::SnapshotPtr snap = m_LayerStack->Acquire();
+		FK_CORE_TRACE("OnRender begin: layers={}", snap->Size());
 
 		size_t idx = 0;
-		for (Layer* layer : *m_LayerStack) {
+		for (Layer* layer : *snap) {
 			if (!layer) {
 				FK_CORE_WARN("OnRender: layer[{}] is null", idx++);
 				continue;
@@ -63,16 +79,15 @@ namespace FrameKit {
 	}
 
 	void Application::OnEvent(Event& e) {
-		std::scoped_lock<std::mutex> lock(m_LayerStackMutex);
-
 		if (!m_LayerStack) {
 			FK_CORE_WARN("OnEvent skipped: LayerStack is null");
 			return;
 		}
 
-		FK_CORE_TRACE("OnEvent dispatch begin: layers={}", m_LayerStack->Size());
+		const LayerStack::SnapshotPtr snap = m_LayerStack->Acquire();
+		FK_CORE_TRACE("OnEvent dispatch begin: layers={}", snap->Size());
 
-		for (auto it = m_LayerStack->rbegin(); it != m_LayerStack->rend(); ++it) {
+		for (auto it = snap->rbegin(); it != snap->rend(); ++it) {
 			Layer* layer = *it;
 			if (!layer) {
 				FK_CORE_WARN("OnEvent: null layer in reverse iteration");
@@ -86,4 +101,15 @@ namespace FrameKit {
 
 		FK_CORE_TRACE("OnEvent dispatch end");
 	}
+
+	void Application::OnAsyncUpdate() {
+		if (!m_LayerStack) return;
+
+		// Runs concurrently with the frame; the snapshot defers retirement of any
+		// layer popped meanwhile until this pass is finished
+		const LayerStack::SnapshotPtr snap = m_LayerStack->Acquire();
+		for (Layer* layer : *snap) {
+			if (layer) layer->OnAsyncUpdate();
+		}
+	}
 } // namespace FrameKit
\ No newline at end of file
@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Application/ApplicationBase.cpp
 // Author       : George Gil
 // Created      : 2025-09-07
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
 //      Implements the ApplicationBase class for the FrameKit framework.
@@ -15,6 +15,7 @@
 #include "FrameKit/Engine/Layer.h"
 #include "FrameKit/Core/Engine/LayerStack.h"
 #include "FrameKit/Debug/Log.h"
+#include "FrameKit/Debug/Instrumentor.h"
 
 namespace FrameKit {
 
@@ -28,26 +29,63 @@ namespace FrameKit {
 		FK_CORE_INFO("ApplicationBase ctor: name='{}' mode={}", m_Specification.Name, (int)m_Specification.Mode);
 	}
 
+	// Layer changes go through LayerStack: applied immediately on the main
+	// thread, staged until SyncLayerStack() when made from any other thread.
 	void ApplicationBase::PushLayer(Layer* layer) {
-		std::scoped_lock<std::mutex> lock(m_LayerStackMutex);
 		if (!m_LayerStack) { FK_CORE_ERROR("PushLayer failed: LayerStack is null"); return; }
 		if (!layer) { FK_CORE_ERROR("PushLayer failed: layer is null"); return; }
 
-		m_LayerStack->PushLayer(layer);
 		FK_CORE_INFO("Layer pushed: {}", layer->GetName());
-		layer->OnAttach();
-		FK_CORE_TRACE("Layer attached: {}", layer->GetName());
+		m_LayerStack->PushLayer(layer);
 	}
 
 	void ApplicationBase::PushOverlay(Layer* layer) {
-		std::scoped_lock<std::mutex> lock(m_LayerStackMutex);
 		if (!m_LayerStack) { FK_CORE_ERROR("PushOverlay failed: LayerStack is null"); return; }
 		if (!layer) { FK_CORE_ERROR("PushOverlay failed: layer is null"); return; }
 
-		m_LayerStack->PushOverlay(layer);
 		FK_CORE_INFO("Overlay pushed: {}", layer->GetName());
-		layer->OnAttach();
-		FK_CORE_TRACE("Overlay attached: {}", layer->GetName());
+		m_LayerStack->PushOverlay(layer);
+	}
+
+	void ApplicationBase::PopLayer(Layer* layer) {
+		if (!m_LayerStack) { FK_CORE_ERROR("PopLayer failed: LayerStack is null"); return; }
+		if (!layer) { FK_CORE_ERROR("PopLayer failed: layer is null"); return; }
+
+		FK_CORE_INFO("Layer pop staged: {}", layer->GetName());
+		m_LayerStack->PopLayer(layer);
+	}
+
+	void ApplicationBase::PopOverlay(Layer* layer) {
+		if (!m_LayerStack) { FK_CORE_ERROR("PopOverlay failed: LayerStack is null"); return; }
+		if (!layer) { FK_CORE_ERROR("PopOverlay failed: layer is null"); return; }
+
+		FK_CORE_INFO("Overlay pop staged: {}", layer->GetName());
+		m_LayerStack->PopOverlay(layer);
+	}
+
+	void ApplicationBase::RequestRedraw() noexcept {
+		m_RedrawRequested.store(true, std::memory_order_release);
+		std::scoped_lock<std::mutex> lock(m_WakeMutex);
+		if (m_WakeFn) m_WakeFn(m_WakeCtx);
+	}
+
+	void ApplicationBase::RequestRedrawIn(Timestep delay) noexcept {
+		using namespace std::chrono;
+		const auto at = steady_clock::now() + duration_cast<steady_clock::duration>(duration<float>(delay.Seconds()));
+		const std::int64_t ns = duration_cast<nanoseconds>(at.time_since_epoch()).count();
+
+		// Keep the earliest pending deadline
+		std::int64_t cur = m_RedrawDeadlineNs.load(std::memory_order_relaxed);
+		while (ns < cur && !m_RedrawDeadlineNs.compare_exchange_weak(cur, ns, std::memory_order_acq_rel)) {}
+
+		// The host has to recompute its wait timeout
+		std::scoped_lock<std::mutex> lock(m_WakeMutex);
+		if (m_WakeFn) m_WakeFn(m_WakeCtx);
+	}
+
+	void ApplicationBase::SyncLayerStack() {
+		FK_PROFILE_FUNCTION();
+		if (m_LayerStack) m_LayerStack->ApplyPending();
 	}
 
 } // namespace FrameKit
@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Debug/Instrumentor.cpp
 // Author       : George Gil
 // Created      : 2025-09-09
-// Updated      : 2025-09-09
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Instrumentation system for profiling C++ code.
 // =============================================================================
@@ -11,38 +11,371 @@
 #include "FrameKit/Debug/Instrumentor.h"
 #include "FrameKit/Debug/Log.h"  // used only for error logs
 
-#include <iomanip>
-#include <sstream>
-#include <thread>
+#include <algorithm>
+#include <bit>
+#include <csignal>
+#include <cstdio>
+#include <new>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace FrameKit {
 
+    namespace {
+        struct TraceRecord {
+            const char*    name;
+            std::int64_t   startTicks;
+            std::int64_t   value;      // duration ticks, counter bits, flow id or frame number
+            TraceEventKind kind;
+
+            std::int64_t EndTicks() const noexcept { return kind == TraceEventKind::Complete ? startTicks + value : startTicks; }
+        };
+
+        constexpr std::uint32_t kChunkRecords = 1024;
+        constexpr auto          kFlushInterval = std::chrono::milliseconds(50);
+
+        struct TraceChunk {
+            std::atomic<std::uint32_t> count{ 0 };        // published by the owning thread
+            std::atomic<TraceChunk*>   next{ nullptr };
+            TraceRecord                records[kChunkRecords];
+        };
+
+        // Flight-recorder slot. Fields are atomics because a dump may read a slot
+        // while its owner overwrites it; such copies are discarded (see Snapshot).
+        struct FlightSlot {
+            std::atomic<const char*>  name{ nullptr };
+            std::atomic<std::int64_t> startTicks{ 0 };
+            std::atomic<std::int64_t> value{ 0 };
+            std::atomic<TraceEventKind> kind{ TraceEventKind::Complete };
+        };
+
+        struct FlightRing {
+            explicit FlightRing(std::uint32_t capacity)
+                : mask(capacity - 1), slots(new (std::nothrow) FlightSlot[capacity]) {}
+
+            const std::uint64_t           mask;
+            std::atomic<std::uint64_t>    head{ 0 };         // records written so far
+            std::unique_ptr<FlightSlot[]> slots;
+        };
+
+        // Per-thread, per-scope histogram. Only the owning thread writes, so
+        // updates are plain load/store pairs; snapshots read them relaxed.
+        struct ScopeHist {
+            std::atomic<std::uint64_t> count{ 0 };
+            std::atomic<std::uint64_t> sumTicks{ 0 };
+            std::atomic<std::uint64_t> minTicks{ UINT64_MAX };
+            std::atomic<std::uint64_t> maxTicks{ 0 };
+            std::atomic<std::uint64_t> buckets[ScopeHistogram::kBuckets]{};
+        };
+
+        // Open-addressed by name pointer; entries are never removed
+        struct ScopeTable {
+            static constexpr std::uint32_t kEntries = 256;   // power of two
+
+            struct Entry {
+                std::atomic<const char*> name{ nullptr };     // published after hist
+                ScopeHist*               hist = nullptr;
+            };
+
+            Entry                      entries[kEntries];
+            std::atomic<std::uint64_t> dropped{ 0 };          // samples of scopes that did not fit
+
+            ~ScopeTable() { for (Entry& e : entries) delete e.hist; }
+        };
+
+        // Plain (non-atomic) sums, for snapshots and exited threads
+        struct ScopeAccum {
+            std::uint64_t              count = 0;
+            std::uint64_t              sumTicks = 0;
+            std::uint64_t              minTicks = UINT64_MAX;
+            std::uint64_t              maxTicks = 0;
+            std::vector<std::uint64_t> buckets = std::vector<std::uint64_t>(ScopeHistogram::kBuckets);
+
+            void Add(const ScopeHist& h) {
+                count += h.count.load(std::memory_order_relaxed);
+                sumTicks += h.sumTicks.load(std::memory_order_relaxed);
+                minTicks = std::min(minTicks, h.minTicks.load(std::memory_order_relaxed));
+                maxTicks = std::max(maxTicks, h.maxTicks.load(std::memory_order_relaxed));
+                for (std::uint32_t i = 0; i < ScopeHistogram::kBuckets; ++i)
+                    buckets[i] += h.buckets[i].load(std::memory_order_relaxed);
+            }
+
+            void Add(const ScopeAccum& a) {
+                count += a.count;
+                sumTicks += a.sumTicks;
+                minTicks = std::min(minTicks, a.minTicks);
+                maxTicks = std::max(maxTicks, a.maxTicks);
+                for (std::uint32_t i = 0; i < ScopeHistogram::kBuckets; ++i) buckets[i] += a.buckets[i];
+            }
+        };
+
+        // Single producer (the owning thread), single consumer (the flusher)
+        struct ThreadTraceBuffer {
+            std::uint32_t            tid = 0;
+            TraceChunk*              write = nullptr;        // producer side
+            TraceChunk*              read = nullptr;         // consumer side
+            std::uint32_t            readIndex = 0;
+            std::atomic<bool>        retired{ false };       // owning thread has exited
+            std::atomic<FlightRing*> ring{ nullptr };        // created on first flight record
+            std::atomic<ScopeTable*> scopes{ nullptr };      // created on first stats record
+
+            ~ThreadTraceBuffer() {
+                delete ring.load(std::memory_order_relaxed);
+                delete scopes.load(std::memory_order_relaxed);
+            }
+        };
+
+        // Leaked on purpose: thread_local buffers may outlive static destruction
+        struct TraceRegistry {
+            std::mutex                      mutex;
+            std::vector<ThreadTraceBuffer*> buffers;
+            std::vector<TraceChunk*>        freeChunks;
+            std::uint32_t                   nextTid = 1;
+
+            // Scope statistics of exited threads, so snapshots stay cumulative
+            std::unordered_map<const char*, ScopeAccum> retiredScopes;
+            std::uint64_t                   retiredDropped = 0;
+
+            static TraceRegistry& Get() {
+                static TraceRegistry* r = new TraceRegistry();
+                return *r;
+            }
+
+            TraceChunk* Acquire() {
+                {
+                    std::scoped_lock lk(mutex);
+                    if (!freeChunks.empty()) {
+                        TraceChunk* c = freeChunks.back();
+                        freeChunks.pop_back();
+                        c->count.store(0, std::memory_order_relaxed);
+                        c->next.store(nullptr, std::memory_order_relaxed);
+                        return c;
+                    }
+                }
+                return new (std::nothrow) TraceChunk();
+            }
+
+            void Release(TraceChunk* c) {
+                std::scoped_lock lk(mutex);
+                freeChunks.push_back(c);
+            }
+        };
+
+        struct ThreadTraceSlot {
+            ThreadTraceBuffer* buffer = nullptr;
+            ~ThreadTraceSlot() { if (buffer) buffer->retired.store(true, std::memory_order_release); }
+        };
+
+        std::atomic<std::uint32_t> g_FlightCapacity{ 1u << 16 };
+
+        // Set from the signal handler, consumed by the flusher
+        std::atomic<bool> g_SignalDump{ false };
+        static_assert(std::atomic<bool>::is_always_lock_free, "signal flag must be lock-free");
+
+#if defined(SIGUSR2)
+        using SignalHandler = void (*)(int);
+        SignalHandler g_PrevHandler = SIG_DFL;
+        bool          g_SignalInstalled = false;
+
+        void OnDumpSignal(int) { g_SignalDump.store(true, std::memory_order_relaxed); }
+
+        void InstallDumpSignal() {
+            if (g_SignalInstalled) return;
+            SignalHandler prev = std::signal(SIGUSR2, OnDumpSignal);
+            if (prev == SIG_ERR) return;
+            g_PrevHandler = prev;
+            g_SignalInstalled = true;
+        }
+
+        void RestoreDumpSignal() {
+            if (!g_SignalInstalled) return;
+            std::signal(SIGUSR2, g_PrevHandler);
+            g_SignalInstalled = false;
+        }
+#else
+        void InstallDumpSignal() {}
+        void RestoreDumpSignal() {}
+#endif
+
+        // Copies the records a ring still holds. The owner stores head (n) before
+        // the release fence that precedes overwriting slot n - capacity, so after
+        // our acquire fence, head tells which copied slots may have been torn.
+        void Snapshot(const FlightRing& ring, std::vector<TraceRecord>& out) {
+            const std::uint64_t cap = ring.mask + 1;
+            const std::uint64_t h1 = ring.head.load(std::memory_order_acquire);
+            const std::uint64_t lo = h1 > cap ? h1 - cap : 0;
+            const std::size_t   first = out.size();
+            for (std::uint64_t i = lo; i < h1; ++i) {
+                const FlightSlot& s = ring.slots[i & ring.mask];
+                out.push_back(TraceRecord{ s.name.load(std::memory_order_relaxed),
+                                           s.startTicks.load(std::memory_order_relaxed),
+                                           s.value.load(std::memory_order_relaxed),
+                                           s.kind.load(std::memory_order_relaxed) });
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const std::uint64_t h2 = ring.head.load(std::memory_order_relaxed);
+            if (h2 - lo >= cap) {
+                const std::size_t torn = static_cast<std::size_t>(std::min<std::uint64_t>(h2 - lo - cap + 1, h1 - lo));
+                out.erase(out.begin() + static_cast<std::ptrdiff_t>(first),
+                          out.begin() + static_cast<std::ptrdiff_t>(first + torn));
+            }
+        }
+
+        // A ring that wrapped mid-frame starts with an "E" whose "B" was
+        // overwritten, and the frame in progress has a "B" without its "E".
+        // Drops both, so viewers see balanced frames only.
+        void TrimUnmatchedFrames(std::vector<TraceRecord>& records) {
+            std::vector<bool> drop(records.size(), false);
+            std::size_t open = 0;
+            for (std::size_t i = 0; i < records.size(); ++i) {
+                if (records[i].kind == TraceEventKind::FrameBegin) ++open;
+                else if (records[i].kind == TraceEventKind::FrameEnd) {
+                    if (open) --open;
+                    else drop[i] = true;
+                }
+            }
+            std::size_t closing = 0;
+            for (std::size_t i = records.size(); open && i-- > 0;) {
+                if (records[i].kind == TraceEventKind::FrameEnd && !drop[i]) ++closing;
+                else if (records[i].kind == TraceEventKind::FrameBegin) {
+                    if (closing) --closing;
+                    else { drop[i] = true; --open; }
+                }
+            }
+            std::size_t n = 0;
+            for (std::size_t i = 0; i < records.size(); ++i)
+                if (!drop[i]) records[n++] = records[i];
+            records.resize(n);
+        }
+
+        TraceEvent ToEvent(const TraceRecord& r, std::uint32_t tid, std::int64_t baseTicks, std::int64_t baseNs,
+                           double nsPerTick) {
+            TraceEvent e;
+            e.kind = r.kind;
+            e.tid = tid;
+            e.name = r.name;
+            e.tsNs = baseNs + static_cast<std::int64_t>(static_cast<double>(r.startTicks - baseTicks) * nsPerTick);
+            switch (r.kind) {
+            case TraceEventKind::Complete: e.durNs = static_cast<std::int64_t>(static_cast<double>(r.value) * nsPerTick); break;
+            case TraceEventKind::Counter:  e.value = std::bit_cast<double>(r.value); break;
+            case TraceEventKind::Instant:  break;
+            default:                       e.id = static_cast<std::uint64_t>(r.value); break;
+            }
+            return e;
+        }
+
+        void AddSample(ThreadTraceBuffer& buf, const char* name, std::uint64_t ticks) noexcept {
+            ScopeTable* table = buf.scopes.load(std::memory_order_relaxed);
+            if (!table) {
+                table = new (std::nothrow) ScopeTable();
+                if (!table) return;
+                buf.scopes.store(table, std::memory_order_release);
+            }
+
+            const auto key = reinterpret_cast<std::uintptr_t>(name);
+            std::uint32_t i = static_cast<std::uint32_t>((key >> 3) * 0x9E3779B97F4A7C15ull >> 56) & (ScopeTable::kEntries - 1);
+            ScopeHist* h = nullptr;
+            for (std::uint32_t probe = 0; probe < ScopeTable::kEntries; ++probe, i = (i + 1) & (ScopeTable::kEntries - 1)) {
+                ScopeTable::Entry& e = table->entries[i];
+                const char* n = e.name.load(std::memory_order_relaxed);
+                if (n == name) { h = e.hist; break; }
+                if (!n) {
+                    e.hist = h = new (std::nothrow) ScopeHist();
+                    if (!h) return;
+                    e.name.store(name, std::memory_order_release);
+                    break;
+                }
+            }
+            if (!h) {
+                table->dropped.store(table->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return;
+            }
+
+            auto bump = [](std::atomic<std::uint64_t>& a, std::uint64_t d) {
+                a.store(a.load(std::memory_order_relaxed) + d, std::memory_order_relaxed);
+            };
+            bump(h->count, 1);
+            bump(h->sumTicks, ticks);
+            bump(h->buckets[ScopeHistogram::BucketOf(ticks)], 1);
+            if (ticks < h->minTicks.load(std::memory_order_relaxed)) h->minTicks.store(ticks, std::memory_order_relaxed);
+            if (ticks > h->maxTicks.load(std::memory_order_relaxed)) h->maxTicks.store(ticks, std::memory_order_relaxed);
+        }
+
+        void CollectScopes(const ScopeTable& table, std::unordered_map<const char*, ScopeAccum>& out) {
+            for (const ScopeTable::Entry& e : table.entries) {
+                const char* name = e.name.load(std::memory_order_acquire);
+                if (name) out[name].Add(*e.hist);
+            }
+        }
+
+        // Chunks hold nothing unread
+        bool FullyRead(const ThreadTraceBuffer* buf) {
+            const TraceChunk* c = buf->read;
+            return buf->readIndex >= c->count.load(std::memory_order_acquire) && !c->next.load(std::memory_order_acquire);
+        }
+
+        // Deletes an exited thread's buffer, keeping its statistics. Caller holds reg.mutex.
+        void ReleaseBuffer(TraceRegistry& reg, ThreadTraceBuffer* buf) {
+            if (const ScopeTable* table = buf->scopes.load(std::memory_order_acquire)) {
+                CollectScopes(*table, reg.retiredScopes);
+                reg.retiredDropped += table->dropped.load(std::memory_order_relaxed);
+            }
+            reg.freeChunks.push_back(buf->read);
+            delete buf;
+        }
+
+        thread_local ThreadTraceBuffer* t_TraceBuffer = nullptr;
+        thread_local ThreadTraceSlot    t_TraceSlot;
+
+        ThreadTraceBuffer* RegisterThread() {
+            TraceRegistry& reg = TraceRegistry::Get();
+            TraceChunk* first = reg.Acquire();
+            if (!first) return nullptr;
+
+            auto* buf = new ThreadTraceBuffer();
+            buf->write = buf->read = first;
+            {
+                std::scoped_lock lk(reg.mutex);
+                buf->tid = reg.nextTid++;
+                reg.buffers.push_back(buf);
+            }
+            t_TraceSlot.buffer = buf;
+            return buf;
+        }
+    } // namespace
+
     Instrumentor& Instrumentor::Get() noexcept {
         static Instrumentor instance;
         return instance;
     }
 
-    Instrumentor::~Instrumentor() { EndSession(); }
+    Instrumentor::~Instrumentor() {
+        StopScopeStats();
+        EndSession();
+    }
 
     void Instrumentor::BeginSession(const std::string& name,
-        const std::filesystem::path& filepath) {
+        const std::filesystem::path& filepath, TraceFormat format) {
+        EndSession();   // joins a running flusher before we take the lock for good
         std::scoped_lock lock(m_Mutex);
 
-        if (m_CurrentSession) {
-            if (auto& lg = Log::GetCoreLogger(); lg)
-                lg->error("Instrumentor::BeginSession('{}') when session '{}' already open.",
-                    name, m_CurrentSession->Name);
-            InternalEndSession();
-        }
-
         std::error_code ec;
         const auto parent = filepath.parent_path();
         if (!parent.empty()) std::filesystem::create_directories(parent, ec);
 
-        m_OutputStream.open(filepath, std::ios::out | std::ios::trunc);
+        m_OutputStream.open(filepath, std::ios::out | std::ios::trunc | std::ios::binary);
         if (m_OutputStream.is_open()) {
+            DrainBuffers(false); // records from between sessions
+            m_BaseTicks = NowTicks();
+            m_BaseNs = NowNs();
             m_CurrentSession = std::make_unique<InstrumentationSession>(InstrumentationSession{ name });
-            WriteHeader();
+            m_Writer = TraceWriter::Create(format);
+            m_Writer->Begin(m_Scratch, name);
+            WriteScratch();
+            StartFlusher();
+            s_Mode.fetch_or(kModeStream, std::memory_order_relaxed);
         }
         else {
             if (auto& lg = Log::GetCoreLogger(); lg)
@@ -51,70 +384,396 @@ namespace FrameKit {
     }
 
     void Instrumentor::EndSession() {
+        const std::uint32_t prev = s_Mode.fetch_and(~(kModeStream | kModeFlight), std::memory_order_relaxed);
+        StopFlusher();
         std::scoped_lock lock(m_Mutex);
+        if (prev & kModeFlight) {
+            RestoreDumpSignal();
+            PruneRetired(true);
+        }
         InternalEndSession();
+        if (IsCollectingStats()) StartFlusher();   // keeps reporting
+    }
+
+    void Instrumentor::StartFlusher() {
+        if (m_Flusher.joinable()) return;
+        m_StopFlusher = false;
+        m_Flusher = std::thread([this] { FlusherMain(); });
+    }
+
+    void Instrumentor::StopFlusher() {
+        if (!m_Flusher.joinable()) return;
+        {
+            std::scoped_lock lk(m_FlushMutex);
+            m_StopFlusher = true;
+        }
+        m_FlushCv.notify_one();
+        m_Flusher.join();
+    }
+
+    void Instrumentor::StartScopeStats(const ScopeStatsSettings& settings) {
+        std::scoped_lock lock(m_Mutex);
+        m_Stats = settings;
+        m_StatsBaseline = CollectScopeStats();
+        m_StatsReported = m_StatsBaseline;
+        s_Mode.fetch_or(kModeStats, std::memory_order_relaxed);
+        StartFlusher();
+    }
+
+    void Instrumentor::StopScopeStats() {
+        // The flusher stays up while a session or the flight recorder needs it
+        if (s_Mode.fetch_and(~kModeStats, std::memory_order_relaxed) == kModeStats) StopFlusher();
+    }
+
+    ScopeStatsSnapshot Instrumentor::SnapshotScopeStats() {
+        std::scoped_lock lock(m_Mutex);
+        return CollectScopeStats().Since(m_StatsBaseline);
+    }
+
+    void Instrumentor::StartFlightRecorder(const FlightRecorderSettings& settings) {
+        EndSession();
+        std::scoped_lock lock(m_Mutex);
+
+        m_Flight = settings;
+        g_FlightCapacity.store(std::bit_ceil(std::max(settings.recordsPerThread, 64u)), std::memory_order_relaxed);
+        DrainBuffers(false); // records from before the recorder started
+        m_BaseTicks = NowTicks();
+        m_BaseNs = NowNs();
+        {
+            std::scoped_lock lk(m_FlushMutex);
+            m_DumpReason = nullptr;
+            m_LastDumpNs = 0;
+            m_DumpCooldownNs = static_cast<std::int64_t>(settings.cooldownSeconds * 1e9);
+        }
+        g_SignalDump.store(false, std::memory_order_relaxed);
+        if (settings.dumpOnSignal) InstallDumpSignal();
+
+        StartFlusher();
+        s_Mode.fetch_or(kModeFlight, std::memory_order_relaxed);
+    }
+
+    std::string Instrumentor::DumpFlightRecorder(const std::string& reason) {
+        std::scoped_lock lock(m_Mutex);
+        if (!IsFlightRecording()) return {};
+        return WriteFlightDump(reason);
+    }
+
+    void Instrumentor::RequestFlightDump(const char* reason) noexcept {
+        if (!IsFlightRecording()) return;
+        {
+            std::scoped_lock lk(m_FlushMutex);
+            const std::int64_t now = NowNs();
+            if (m_DumpReason || (m_LastDumpNs && now - m_LastDumpNs < m_DumpCooldownNs)) return;
+            m_DumpReason = reason;
+            m_LastDumpNs = now;
+        }
+        m_FlushCv.notify_one();
     }
 
     void Instrumentor::InternalEndSession() {
         if (m_CurrentSession) {
-            WriteFooter();
+            DrainBuffers(true);
+            m_Writer->End(m_Scratch);
+            WriteScratch();
             m_OutputStream.close();
             m_CurrentSession.reset();
+            m_Writer.reset();
         }
     }
 
-    void Instrumentor::WriteHeader() {
-        m_OutputStream << "{\"otherData\": {},\"traceEvents\":[{}";
-        m_OutputStream.flush();
+    void Instrumentor::FlusherMain() {
+        std::unique_lock lk(m_FlushMutex);
+        while (!m_StopFlusher) {
+            m_FlushCv.wait_for(lk, kFlushInterval, [this] { return m_StopFlusher || m_DumpReason; });
+            if (m_StopFlusher) break;
+            const char* reason = std::exchange(m_DumpReason, nullptr);
+            lk.unlock();
+            // An operator asked explicitly: not subject to the cooldown
+            if (!reason && g_SignalDump.exchange(false, std::memory_order_relaxed)) reason = "signal";
+            {
+                std::scoped_lock lock(m_Mutex);
+                if (IsFlightRecording()) {
+                    if (reason) WriteFlightDump(reason);
+                    PruneRetired(false);
+                }
+                else if (m_CurrentSession) {
+                    DrainBuffers(true);
+                }
+                else {
+                    PruneRetired(false);
+                }
+                if (IsCollectingStats() && m_Stats.reportIntervalSec > 0.0 &&
+                    NowNs() - m_StatsReported.takenNs >= static_cast<std::int64_t>(m_Stats.reportIntervalSec * 1e9))
+                    ReportScopeStats();
+            }
+            lk.lock();
+        }
     }
 
-    void Instrumentor::WriteFooter() {
-        m_OutputStream << "]}";
-        m_OutputStream.flush();
-    }
+    std::string Instrumentor::WriteFlightDump(const std::string& reason) {
+        TraceRegistry& reg = TraceRegistry::Get();
+        std::vector<ThreadTraceBuffer*> buffers;
+        {
+            std::scoped_lock lk(reg.mutex);
+            buffers = reg.buffers;
+        }
+
+        const double nsPerTick = NsPerTick();
+        const std::int64_t nowTicks = NowTicks();
+        const std::int64_t windowTicks = static_cast<std::int64_t>(m_Flight.windowSeconds * 1e9 / nsPerTick);
+        const std::int64_t oldest = std::max(m_BaseTicks, nowTicks - windowTicks);
 
-    std::string Instrumentor::EscapeForJson(const std::string& s) {
         std::string out;
-        out.reserve(s.size());
-        for (char c : s) {
-            switch (c) {
-            case '\"': out += "\\\""; break;
-            case '\\': out += "\\\\"; break;
-            case '\b': out += "\\b";  break;
-            case '\f': out += "\\f";  break;
-            case '\n': out += "\\n";  break;
-            case '\r': out += "\\r";  break;
-            case '\t': out += "\\t";  break;
-            default:   out += c;      break;
+        const auto writer = TraceWriter::Create(m_Flight.format);
+        writer->Begin(out, "flight recorder: " + reason);
+        std::vector<TraceRecord> records;
+        for (ThreadTraceBuffer* buf : buffers) {
+            const FlightRing* ring = buf->ring.load(std::memory_order_acquire);
+            if (!ring || !ring->slots) continue;
+            records.clear();
+            Snapshot(*ring, records);
+            // Rings outlive recorder restarts; also drop what fell out of the window
+            std::erase_if(records, [&](const TraceRecord& r) { return r.startTicks < m_BaseTicks || r.EndTicks() < oldest; });
+            TrimUnmatchedFrames(records);
+            for (const TraceRecord& r : records)
+                writer->Write(out, ToEvent(r, buf->tid, m_BaseTicks, m_BaseNs, nsPerTick), r.name);
+        }
+        writer->End(out);
+
+        std::string safeReason;
+        for (char c : reason) {
+            const bool keep = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' || c == '_';
+            safeReason += keep ? c : '_';
+        }
+        const auto unixMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        const std::filesystem::path dir(m_Flight.directory.empty() ? "." : m_Flight.directory);
+        const std::filesystem::path path = dir / ("flight_" + std::to_string(unixMs) + "_" + safeReason + TraceWriter::Extension(m_Flight.format));
+
+        std::error_code ec;
+        std::filesystem::create_directories(dir, ec);
+        std::ofstream file(path, std::ios::out | std::ios::trunc | std::ios::binary);
+        file.write(out.data(), static_cast<std::streamsize>(out.size()));
+        file.close();
+        if (!file) {
+            if (auto& lg = Log::GetCoreLogger(); lg)
+                lg->error("Instrumentor could not write flight recording '{}'.", path.string());
+            return {};
+        }
+        if (auto& lg = Log::GetCoreLogger(); lg)
+            lg->info("Flight recording ({}) written to '{}'.", reason, path.string());
+        return path.string();
+    }
+
+    void Instrumentor::PruneRetired(bool all) {
+        TraceRegistry& reg = TraceRegistry::Get();
+        const std::int64_t nowTicks = NowTicks();
+        const std::int64_t windowTicks = all ? 0 : static_cast<std::int64_t>(m_Flight.windowSeconds * 1e9 / NsPerTick());
+
+        std::scoped_lock lk(reg.mutex);
+        std::erase_if(reg.buffers, [&](ThreadTraceBuffer* buf) {
+            if (!buf->retired.load(std::memory_order_acquire) || !FullyRead(buf)) return false;
+            // Keep an exited thread's ring until its newest record leaves the window
+            if (const FlightRing* ring = buf->ring.load(std::memory_order_acquire); ring && !all) {
+                const std::uint64_t h = ring->head.load(std::memory_order_acquire);
+                if (h && ring->slots) {
+                    const FlightSlot& s = ring->slots[(h - 1) & ring->mask];
+                    const TraceRecord last{ nullptr, s.startTicks.load(std::memory_order_relaxed),
+                                            s.value.load(std::memory_order_relaxed), s.kind.load(std::memory_order_relaxed) };
+                    if (last.EndTicks() >= nowTicks - windowTicks) return false;
+                }
             }
+            ReleaseBuffer(reg, buf);
+            return true;
+        });
+    }
+
+    void Instrumentor::DrainBuffers(bool write) {
+        TraceRegistry& reg = TraceRegistry::Get();
+        std::vector<ThreadTraceBuffer*> buffers;
+        {
+            std::scoped_lock lk(reg.mutex);
+            buffers = reg.buffers;
         }
-        return out;
+
+        const double nsPerTick = write ? NsPerTick() : 1.0;
+        for (ThreadTraceBuffer* buf : buffers) {
+            for (;;) {
+                TraceChunk* c = buf->read;
+                const std::uint32_t n = c->count.load(std::memory_order_acquire);
+                for (; buf->readIndex < n; ++buf->readIndex) {
+                    if (!write) continue;
+                    const TraceRecord& r = c->records[buf->readIndex];
+                    m_Writer->Write(m_Scratch, ToEvent(r, buf->tid, m_BaseTicks, m_BaseNs, nsPerTick), r.name);
+                }
+                if (n < kChunkRecords) break;
+                TraceChunk* next = c->next.load(std::memory_order_acquire);
+                if (!next) break;
+                buf->read = next;
+                buf->readIndex = 0;
+                reg.Release(c);
+            }
+            if (write && m_Scratch.size() >= (1u << 16)) WriteScratch();
+        }
+        if (write) {
+            WriteScratch();
+            m_OutputStream.flush();
+        }
+
+        // Threads that exited and have nothing left to read
+        std::scoped_lock lk(reg.mutex);
+        std::erase_if(reg.buffers, [&](ThreadTraceBuffer* buf) {
+            // `retired` is stored after the thread's last record, so this acquire makes them all visible
+            if (!buf->retired.load(std::memory_order_acquire) || !FullyRead(buf)) return false;
+            ReleaseBuffer(reg, buf);
+            return true;
+        });
+    }
+
+    ScopeStatsSnapshot Instrumentor::CollectScopeStats() {
+        TraceRegistry& reg = TraceRegistry::Get();
+        std::unordered_map<const char*, ScopeAccum> byName;
+        ScopeStatsSnapshot snap;
+        snap.takenNs = NowNs();
+        snap.frames = s_Frames.load(std::memory_order_relaxed);
+        {
+            std::scoped_lock lk(reg.mutex);
+            for (const auto& [name, accum] : reg.retiredScopes) byName[name].Add(accum);
+            snap.dropped = reg.retiredDropped;
+            for (const ThreadTraceBuffer* buf : reg.buffers) {
+                if (const ScopeTable* table = buf->scopes.load(std::memory_order_acquire)) {
+                    CollectScopes(*table, byName);
+                    snap.dropped += table->dropped.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Equal names from different call sites (e.g. an inline function in
+        // several modules) are one scope
+        const double nsPerTick = NsPerTick();
+        std::unordered_map<std::string_view, ScopeAccum> merged;
+        for (const auto& [name, accum] : byName) merged[name].Add(accum);
+
+        snap.scopes.reserve(merged.size());
+        for (auto& [name, a] : merged) {
+            ScopeStats s;
+            s.name = std::string(name);
+            s.count = a.count;
+            s.nsPerTick = nsPerTick;
+            s.totalNs = static_cast<double>(a.sumTicks) * nsPerTick;
+            s.minNs = a.count ? static_cast<double>(a.minTicks) * nsPerTick : 0.0;
+            s.maxNs = static_cast<double>(a.maxTicks) * nsPerTick;
+            s.buckets = std::move(a.buckets);
+            snap.scopes.push_back(std::move(s));
+        }
+        std::sort(snap.scopes.begin(), snap.scopes.end(),
+            [](const ScopeStats& a, const ScopeStats& b) { return a.totalNs > b.totalNs; });
+        return snap;
+    }
+
+    void Instrumentor::ReportScopeStats() {
+        ScopeStatsSnapshot now = CollectScopeStats();
+        const ScopeStatsSnapshot interval = now.Since(m_StatsReported);
+        m_StatsReported = std::move(now);
+
+        auto& lg = Log::GetCoreLogger();
+        if (!lg || interval.scopes.empty()) return;
+        lg->info("Scope stats over {} ms, {} frames:", (interval.takenNs - interval.sinceNs) / 1'000'000, interval.frames);
+        for (const std::string& line : interval.FormatReport(m_Stats.reportTopScopes)) lg->info("  {}", line);
+        if (interval.dropped) lg->warn("  {} samples dropped: scope table full", interval.dropped);
+    }
+
+    double Instrumentor::NsPerTick() {
+#if !FK_TRACE_TSC
+        return 1.0; // ticks are nanoseconds
+#else
+        // Calibrate over at least a millisecond; longer sessions average out clock-read jitter
+        std::int64_t ticks = NowTicks(), ns = NowNs();
+        while (ns - m_CalNs < 1'000'000) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            ticks = NowTicks();
+            ns = NowNs();
+        }
+        return static_cast<double>(ns - m_CalNs) / static_cast<double>(ticks - m_CalTicks);
+#endif
+    }
+
+    void Instrumentor::Record(const char* name, std::int64_t startTicks, std::int64_t endTicks) noexcept {
+        Emit(TraceEventKind::Complete, name, startTicks, endTicks - startTicks);
+    }
+
+    void Instrumentor::Emit(TraceEventKind kind, const char* name, std::int64_t ticks, std::int64_t value) noexcept {
+        ThreadTraceBuffer* buf = t_TraceBuffer;
+        if (!buf) {
+            buf = RegisterThread();
+            if (!buf) return;
+            t_TraceBuffer = buf;
+        }
+
+        const std::uint32_t mode = s_Mode.load(std::memory_order_relaxed);
+        if ((mode & kModeStats) && kind == TraceEventKind::Complete)
+            AddSample(*buf, name, static_cast<std::uint64_t>(std::max<std::int64_t>(value, 0)));
+
+        if (mode & kModeFlight) {
+            FlightRing* ring = buf->ring.load(std::memory_order_relaxed);
+            if (!ring) {
+                ring = new (std::nothrow) FlightRing(g_FlightCapacity.load(std::memory_order_relaxed));
+                if (!ring) return;
+                buf->ring.store(ring, std::memory_order_release);
+            }
+            if (!ring->slots) return;
+            const std::uint64_t h = ring->head.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);   // see Snapshot()
+            FlightSlot& s = ring->slots[h & ring->mask];
+            s.name.store(name, std::memory_order_relaxed);
+            s.startTicks.store(ticks, std::memory_order_relaxed);
+            s.value.store(value, std::memory_order_relaxed);
+            s.kind.store(kind, std::memory_order_relaxed);
+            ring->head.store(h + 1, std::memory_order_release);
+            return;
+        }
+        if (!(mode & kModeStream)) return;
+
+        TraceChunk* c = buf->write;
+        std::uint32_t i = c->count.load(std::memory_order_relaxed);
+        if (i == kChunkRecords) {
+            TraceChunk* next = TraceRegistry::Get().Acquire();
+            if (!next) return; // out of memory: drop the record
+            c->next.store(next, std::memory_order_release);
+            buf->write = c = next;
+            i = 0;
+        }
+        c->records[i] = TraceRecord{ name, ticks, value, kind };
+        c->count.store(i + 1, std::memory_order_release);
+    }
+
+    void Instrumentor::WriteScratch() {
+        if (!m_Scratch.empty()) m_OutputStream.write(m_Scratch.data(), static_cast<std::streamsize>(m_Scratch.size()));
+        m_Scratch.clear();
     }
 
     void Instrumentor::WriteProfile(const ProfileResult& result) {
-        std::ostringstream json;
-        json << std::setprecision(3) << std::fixed;
-        json << ",{"
-            << "\"cat\":\"function\","
-            << "\"dur\":" << result.ElapsedTime.count() << ','
-            << "\"name\":\"" << EscapeForJson(result.Name) << "\","
-            << "\"ph\":\"X\","
-            << "\"pid\":0,"
-            << "\"tid\":" << result.ThreadID << ","
-            << "\"ts\":" << result.Start.count()
-            << "}";
+        TraceEvent e;
+        e.tid = static_cast<std::uint32_t>(result.ThreadID);
+        e.name = result.Name;
+        e.tsNs = static_cast<std::int64_t>(result.Start.count() * 1000.0);
+        e.durNs = std::chrono::duration_cast<std::chrono::nanoseconds>(result.ElapsedTime).count();
         std::scoped_lock lock(m_Mutex);
-        if (m_CurrentSession) {
-            m_OutputStream << json.str();
-            m_OutputStream.flush();
-        }
+        if (!m_CurrentSession) return;
+        m_Writer->Write(m_Scratch, e, nullptr);
+        WriteScratch();
     }
 
     // -------- Timer --------
     InstrumentationTimer::InstrumentationTimer(const char* name) noexcept
         : m_Name(name),
-        m_StartTimepoint(std::chrono::steady_clock::now()),
-        m_Stopped(false) {
+        m_StartTicks(0),
+        m_Stopped(true) {
+        // Scopes opened outside a session cost one relaxed load
+        if (Instrumentor::IsActive()) {
+            m_StartTicks = Instrumentor::NowTicks();
+            m_Stopped = false;
+        }
     }
 
     InstrumentationTimer::~InstrumentationTimer() {
@@ -122,17 +781,8 @@ namespace FrameKit {
     }
 
     void InstrumentationTimer::Stop() noexcept {
-        const auto endTimepoint = std::chrono::steady_clock::now();
-
-        const auto start_us = std::chrono::time_point_cast<std::chrono::microseconds>(m_StartTimepoint).time_since_epoch();
-        const auto end_us = std::chrono::time_point_cast<std::chrono::microseconds>(endTimepoint).time_since_epoch();
-        const auto elapsed = end_us - start_us;
-        const auto start_f64 = FloatingPointMicroseconds{ start_us }; // implicit conversion OK
-
-        const std::uint64_t tid =
-            static_cast<std::uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
-
-        Instrumentor::Get().WriteProfile({ m_Name, start_f64, elapsed, tid });
+        if (m_Stopped) return;
+        Instrumentor::Record(m_Name, m_StartTicks, Instrumentor::NowTicks());
         m_Stopped = true;
     }
 
@@ -3,21 +3,18 @@
 // File         : src/FrameKit/Debug/Log.cpp
 // Author       : George Gil
 // Created      : 2025-09-09
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Implements FrameKit Logger and Log.
 // =============================================================================
 
 #include "FrameKit/Engine/PlatformDetection.h"
 #include "FrameKit/Debug/Log.h"
+#include "FrameKit/Debug/LogSink.h"
+#include "LogBackend.h"
 
-#if defined(FK_PLATFORM_WINDOWS)
-    #define NOMINMAX
-    #include <windows.h>
-#endif
-
+#include <algorithm>
 #include <cstdio>
-#include <cstring>
 #include <ctime>
 
 namespace FrameKit {
@@ -26,17 +23,62 @@ namespace FrameKit {
     Ref<Logger> Log::s_CoreLogger;
     Ref<Logger> Log::s_ClientLogger;
 
+    namespace {
+        // Template for the default "<name>.log" sinks; guarded by Log::s_Mutex
+        FileSinkSettings s_FileSettings{};
+
+        void replace_sink(std::vector<Ref<LogSink>>& sinks, Ref<LogSink>& slot, Ref<LogSink> next) {
+            if (slot) {
+                slot->Flush();
+                sinks.erase(std::remove(sinks.begin(), sinks.end(), slot), sinks.end());
+            }
+            slot = std::move(next);
+            if (slot) sinks.push_back(slot);
+        }
+    }
+
     void Logger::set_file(const std::string& path, bool append) {
+        FileSinkSettings settings;
+        settings.path = path;
+        settings.append = append;
+        set_file(settings);
+    }
+
+    void Logger::set_file(const FileSinkSettings& settings) {
         std::scoped_lock lk(m_Mutex);
-        m_File.close();
-        std::ios_base::openmode mode = std::ios::out;
-        if (append) mode |= std::ios::app;
-        m_File.open(path, mode);
+        if (m_FileSink && static_cast<FileSink&>(*m_FileSink).Settings() == settings) return;
+        replace_sink(m_Sinks, m_FileSink, settings.path.empty() ? nullptr : CreateRef<FileSink>(settings));
     }
 
-    std::string Logger::now_hms() noexcept {
+    void Logger::enable_console(bool on) {
+        std::scoped_lock lk(m_Mutex);
+        if (on == static_cast<bool>(m_ConsoleSink)) return;
+        replace_sink(m_Sinks, m_ConsoleSink, on ? CreateRef<ConsoleSink>() : nullptr);
+    }
+
+    void Logger::add_sink(Ref<LogSink> sink) {
+        if (!sink) return;
+        std::scoped_lock lk(m_Mutex);
+        m_Sinks.push_back(std::move(sink));
+    }
+
+    void Logger::remove_sink(const Ref<LogSink>& sink) {
+        std::scoped_lock lk(m_Mutex);
+        const auto it = std::find(m_Sinks.begin(), m_Sinks.end(), sink);
+        if (it == m_Sinks.end()) return;
+        (*it)->Flush();
+        m_Sinks.erase(it);
+        if (sink == m_ConsoleSink) m_ConsoleSink.reset();
+        if (sink == m_FileSink) m_FileSink.reset();
+    }
+
+    std::int64_t Logger::now_ns() noexcept {
         using namespace std::chrono;
-        auto t = system_clock::to_time_t(system_clock::now());
+        return duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count();
+    }
+
+    std::string Logger::format_hms(std::int64_t unixNs) noexcept {
+        auto t = static_cast<std::time_t>(unixNs / 1000000000);
         std::tm bt{};
 #if defined(FK_PLATFORM_WINDOWS)
         localtime_s(&bt, &t);
@@ -49,38 +91,54 @@ namespace FrameKit {
     }
 
     void Logger::write_line(LogLevel lvl, const std::string& message) noexcept {
+        const std::int64_t ns = now_ns();
+        if (LogBackend::Get().Push(this, lvl, m_Module, ns, message)) return;
+        write_record(lvl, m_Module, ns, message);
+        commit_sinks();
+    }
+
+    void Logger::write_binary(LogLevel lvl, LogModule module, const detail::FormatSpec& spec, const detail::LogArg* kinds,
+                              std::size_t argc, const std::byte* data, std::size_t size) noexcept {
+        const std::int64_t ns = now_ns();
+        if (LogBackend::Get().PushBinary(this, lvl, module, ns, spec, kinds, argc, data, size)) return;
+        try {
+            std::string msg;
+            detail::FormatLogArgs(msg, spec, kinds, argc, data, size);
+            write_record(lvl, module, ns, msg);
+            commit_sinks();
+        }
+        catch (...) {
+        }
+    }
+
+    void Logger::write_record(LogLevel lvl, LogModule module, std::int64_t unixNs, std::string_view message) noexcept {
         std::ostringstream line;
-        line << "[" << now_hms() << "] "
+        line << "[" << format_hms(unixNs) << "] "
             << "[" << detail::level_to_cstr(lvl) << "] "
-            << m_Name << ": " << message;
+            << m_Name;
+        if (module != m_Module && module != LogModule::Core && module != LogModule::Client && module != LogModule::Count)
+            line << '/' << detail::module_to_cstr(module);
+        line << ": " << message;
 
         const std::string s = line.str();
 
         std::scoped_lock lk(m_Mutex);
-        if (m_Console.load(std::memory_order_relaxed)) {
-#if defined(FK_PLATFORM_WINDOWS)
-            // Enable ANSI VT once
-            static bool vtEnabled = false;
-            if (!vtEnabled) {
-                if (HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE); hOut != INVALID_HANDLE_VALUE) {
-                    DWORD mode = 0;
-                    if (GetConsoleMode(hOut, &mode)) {
-                        mode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
-                        SetConsoleMode(hOut, mode);
-                    }
-                }
-                vtEnabled = true;
-            }
-#endif
-            const char* color = detail::level_to_ansi(lvl);
-            std::fwrite(color, 1, std::strlen(color), stdout);
-            std::fwrite(s.c_str(), 1, s.size(), stdout);
-            std::fwrite("\x1b[0m\n", 1, 5, stdout);
-            std::fflush(stdout);
+        for (const Ref<LogSink>& sink : m_Sinks) sink->Write(lvl, unixNs, s);
+    }
+
+    void Logger::commit_sinks() noexcept {
+        std::scoped_lock lk(m_Mutex);
+        for (const Ref<LogSink>& sink : m_Sinks) {
+            try { sink->Commit(); }
+            catch (...) {}
         }
-        if (m_File.is_open()) {
-            m_File << s << '\n';
-            m_File.flush();
+    }
+
+    void Logger::flush_sinks() noexcept {
+        std::scoped_lock lk(m_Mutex);
+        for (const Ref<LogSink>& sink : m_Sinks) {
+            try { sink->Flush(); }
+            catch (...) {}
         }
     }
 
@@ -101,7 +159,10 @@ namespace FrameKit {
     static void setup_common(Ref<Logger>& logger, const std::string& fileName, LogLevel level) {
         logger->set_level(level);
         logger->enable_console(true);
-        if (!fileName.empty()) logger->set_file(fileName, true);
+        if (fileName.empty()) return;
+        FileSinkSettings file = s_FileSettings;
+        file.path = fileName;
+        logger->set_file(file);
     }
 
     void Log::Init() {
@@ -113,6 +174,8 @@ namespace FrameKit {
         if (!s_CoreLogger)   s_CoreLogger = CreateRef<Logger>("FrameKit");
         if (!s_ClientLogger) s_ClientLogger = CreateRef<Logger>("Application");
 
+        s_CoreLogger->bind_module(LogModule::Core);
+        s_ClientLogger->bind_module(LogModule::Client);
         setup_common(s_CoreLogger, "FrameKit.log", core_lvl);
         setup_common(s_ClientLogger, "Application.log", client_lvl);
     }
@@ -125,8 +188,11 @@ namespace FrameKit {
         const LogLevel prev_client_lvl = s_ClientLogger ? s_ClientLogger->level() : LogLevel::Trace;
 
         if (!s_CoreLogger) s_CoreLogger = CreateRef<Logger>("FrameKit");
+        if (s_ClientLogger) LogBackend::Get().Flush(); // queued records still point at the old client
         s_ClientLogger = CreateRef<Logger>(clientName);
 
+        s_CoreLogger->bind_module(LogModule::Core);
+        s_ClientLogger->bind_module(LogModule::Client);
         setup_common(s_CoreLogger, "FrameKit.log", core_lvl);
         setup_common(s_ClientLogger, clientName + ".log", prev_client_lvl);
     }
@@ -136,7 +202,65 @@ namespace FrameKit {
         if (!s_ClientLogger) return;
         s_ClientLogger->set_level(LogLevel::Off);
         s_ClientLogger->enable_console(false);
-        s_ClientLogger.reset();
+        // Unpublish first, then drain: queued records still point at the logger
+        const Ref<Logger> client = std::move(s_ClientLogger);
+        LogBackend::Get().Flush();
+        client->flush_sinks();
+    }
+
+    void Log::StartAsync(const AsyncLogSettings& settings) {
+        LogBackend::Get().Start(settings);
+        FK_CORE_INFO("Async logging: capacity={} overflow={}", settings.capacity,
+            settings.overflow == LogOverflow::Block ? "block" : settings.overflow == LogOverflow::Drop ? "drop" : "drop-oldest");
+    }
+
+    void Log::StopAsync() {
+        const std::uint64_t dropped = LogBackend::Get().Dropped();
+        LogBackend::Get().Stop();
+        Flush();
+        if (dropped) FK_CORE_WARN("Async logging dropped {} records", dropped);
+    }
+
+    void Log::SetModuleLevel(LogModule module, LogLevel level) {
+        if (module == LogModule::Count) return;
+        if (module == LogModule::Core || module == LogModule::Client) {
+            Ref<Logger>& logger = (module == LogModule::Core) ? GetCoreLogger() : GetClientLogger();
+            if (logger != Noop()) { logger->set_level(level); return; }
+        }
+        detail::g_LogModuleLevels[static_cast<std::size_t>(module)].store(level, std::memory_order_relaxed);
+    }
+
+    LogLevel Log::GetModuleLevel(LogModule module) noexcept {
+        if (module == LogModule::Count) return LogLevel::Off;
+        return detail::g_LogModuleLevels[static_cast<std::size_t>(module)].load(std::memory_order_relaxed);
+    }
+
+    bool Log::IsAsync() noexcept { return LogBackend::Get().Running(); }
+    void Log::SetFileSettings(const FileSinkSettings& settings) {
+        std::scoped_lock lk(s_Mutex);
+        s_FileSettings = settings;
+        for (Ref<Logger>* logger : { &s_CoreLogger, &s_ClientLogger }) {
+            if (!*logger) continue;
+            FileSinkSettings file = settings;
+            file.path = (*logger)->m_Name + ".log";
+            (*logger)->set_file(file);
+        }
+    }
+
+    void Log::CommitSinks() noexcept {
+        // The writer thread must never wait here: InitClient holds s_Mutex while it waits for the writer
+        std::unique_lock lk(s_Mutex, std::try_to_lock);
+        if (!lk.owns_lock()) return;
+        if (s_CoreLogger) s_CoreLogger->commit_sinks();
+        if (s_ClientLogger) s_ClientLogger->commit_sinks();
+    }
+
+    void Log::Flush() {
+        LogBackend::Get().Flush();
+        std::scoped_lock lk(s_Mutex);
+        if (s_CoreLogger) s_CoreLogger->flush_sinks();
+        if (s_ClientLogger) s_ClientLogger->flush_sinks();
     }
+    std::uint64_t Log::DroppedCount() noexcept { return LogBackend::Get().Dropped(); }
 
 } // namespace FrameKit
@@ -0,0 +1,261 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Debug/LogBackend.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Async log backend: bounded record queue and writer thread
+// =============================================================================
+
+#include "LogBackend.h"
+#include "FrameKit/Debug/Instrumentor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace FrameKit {
+
+    namespace {
+        constexpr std::size_t kBatch = 256;   // records written between sink flushes
+        constexpr auto        kIdleWait = std::chrono::milliseconds(50);
+
+        std::uint64_t RoundUpPow2(std::uint64_t v) noexcept {
+            std::uint64_t p = 2;
+            while (p < v) p <<= 1;
+            return p;
+        }
+    }
+
+    // Intentionally leaked: loggers may run during static destruction
+    LogBackend& LogBackend::Get() noexcept {
+        static LogBackend* inst = new LogBackend();
+        return *inst;
+    }
+
+    void LogBackend::Start(const AsyncLogSettings& s) {
+        std::scoped_lock lock(m_ControlMutex);
+        if (m_Running.load(std::memory_order_acquire)) return;
+
+        const std::uint64_t cap = RoundUpPow2(std::max<std::uint32_t>(s.capacity, 16));
+        m_Records = std::make_unique<Record[]>(cap);
+        for (std::uint64_t i = 0; i < cap; ++i) m_Records[i].seq.store(i, std::memory_order_relaxed);
+        m_Mask = cap - 1;
+        m_Overflow = s.overflow;
+        m_Tail.store(0, std::memory_order_relaxed);
+        m_Head.store(0, std::memory_order_relaxed);
+        m_Completed.store(0, std::memory_order_relaxed);
+        m_Stop.store(false, std::memory_order_relaxed);
+
+        m_Writer = std::thread([this] {
+            // Before anything the writer could log, so it never enqueues to itself
+            m_WriterId.store(std::this_thread::get_id(), std::memory_order_relaxed);
+            WriterMain();
+        });
+        m_Running.store(true, std::memory_order_release);
+    }
+
+    void LogBackend::Stop() {
+        std::scoped_lock lock(m_ControlMutex);
+        if (!m_Running.load(std::memory_order_acquire)) return;
+
+        // New records go the synchronous path from here on; the writer drains the rest
+        m_Running.store(false, std::memory_order_seq_cst);
+        m_Stop.store(true, std::memory_order_release);
+        Wake();
+        m_Writer.join();
+        m_WriterId.store(std::thread::id{}, std::memory_order_relaxed);
+
+        // Producers that passed the running check before the switch publish within a few instructions
+        while (m_Head.load(std::memory_order_acquire) != m_Tail.load(std::memory_order_acquire)) {
+            Logger* logger = nullptr;
+            if (TryDequeue(true, logger)) {
+                if (logger) logger->flush_sinks();
+                m_Completed.fetch_add(1, std::memory_order_release);
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    bool LogBackend::Push(Logger* logger, LogLevel lvl, LogModule module, std::int64_t unixNs, std::string_view message) noexcept {
+        return Enqueue(logger, lvl, module, unixNs, Payload{ nullptr, nullptr, 0, message.data(), message.size() });
+    }
+
+    bool LogBackend::PushBinary(Logger* logger, LogLevel lvl, LogModule module, std::int64_t unixNs, const detail::FormatSpec& spec,
+                                const detail::LogArg* kinds, std::size_t argc, const std::byte* data, std::size_t size) noexcept {
+        return Enqueue(logger, lvl, module, unixNs, Payload{ &spec, kinds, argc, data, size });
+    }
+
+    bool LogBackend::Enqueue(Logger* logger, LogLevel lvl, LogModule module, std::int64_t unixNs, const Payload& payload) noexcept {
+        if (!m_Running.load(std::memory_order_acquire)) return false;
+        // Never wait on ourselves
+        if (std::this_thread::get_id() == m_WriterId.load(std::memory_order_relaxed)) return false;
+
+        for (;;) {
+            if (TryEnqueue(logger, lvl, module, unixNs, payload)) {
+                if (m_Sleeping.load(std::memory_order_seq_cst)) Wake();
+                return true;
+            }
+            switch (m_Overflow) {
+            case LogOverflow::Drop:
+                m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            case LogOverflow::DropOldest: {
+                Logger* unused = nullptr;
+                if (TryDequeue(false, unused)) {
+                    m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                    m_Completed.fetch_add(1, std::memory_order_release);
+                }
+                break;
+            }
+            case LogOverflow::Block:
+                Wake();
+                std::this_thread::yield();
+                if (!m_Running.load(std::memory_order_acquire)) return false;
+                break;
+            }
+        }
+    }
+
+    bool LogBackend::TryEnqueue(Logger* logger, LogLevel lvl, LogModule module, std::int64_t unixNs, const Payload& payload) noexcept {
+        std::uint64_t pos = m_Tail.load(std::memory_order_relaxed);
+        Record* r;
+        for (;;) {
+            r = &At(pos);
+            const std::uint64_t seq = r->seq.load(std::memory_order_acquire);
+            const auto dif = static_cast<std::int64_t>(seq - pos);
+            if (dif == 0) {
+                if (m_Tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            }
+            else if (dif < 0) {
+                return false; // full
+            }
+            else {
+                pos = m_Tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        r->logger = logger;
+        r->level = lvl;
+        r->module = module;
+        r->unixNs = unixNs;
+        r->spec = payload.spec;
+        r->kinds = payload.kinds;
+        r->argc = static_cast<std::uint16_t>(payload.argc);
+        r->len = static_cast<std::uint32_t>(payload.size);
+        r->spill = nullptr;
+        if (payload.size <= kInline) {
+            if (payload.size) std::memcpy(r->text, payload.data, payload.size);
+        }
+        else {
+            try { r->spill = new std::string(static_cast<const char*>(payload.data), payload.size); }
+            catch (...) { r->len = 0; }
+        }
+        r->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool LogBackend::TryDequeue(bool write, Logger*& touched) noexcept {
+        std::uint64_t pos = m_Head.load(std::memory_order_relaxed);
+        Record* r;
+        for (;;) {
+            r = &At(pos);
+            const std::uint64_t seq = r->seq.load(std::memory_order_acquire);
+            const auto dif = static_cast<std::int64_t>(seq - (pos + 1));
+            if (dif == 0) {
+                if (m_Head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            }
+            else if (dif < 0) {
+                return false; // empty
+            }
+            else {
+                pos = m_Head.load(std::memory_order_relaxed);
+            }
+        }
+
+        if (write && r->logger) {
+            const std::string_view bytes = r->spill ? std::string_view(*r->spill) : std::string_view(r->text, r->len);
+            if (r->spec) {
+                thread_local std::string msg;
+                msg.clear();
+                detail::FormatLogArgs(msg, *r->spec, r->kinds, r->argc,
+                                      reinterpret_cast<const std::byte*>(bytes.data()), bytes.size());
+                r->logger->write_record(r->level, r->module, r->unixNs, msg);
+            }
+            else {
+                r->logger->write_record(r->level, r->module, r->unixNs, bytes);
+            }
+            touched = r->logger;
+        }
+        delete r->spill;
+        r->spill = nullptr;
+        r->seq.store(pos + m_Mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool LogBackend::Empty() noexcept {
+        const std::uint64_t pos = m_Head.load(std::memory_order_seq_cst);
+        return At(pos).seq.load(std::memory_order_seq_cst) != pos + 1;
+    }
+
+    void LogBackend::Wake() noexcept {
+        {
+            std::scoped_lock lock(m_WakeMutex);
+            m_WakeFlag = true;
+        }
+        m_WakeCv.notify_one();
+    }
+
+    void LogBackend::Flush() {
+        if (!m_Running.load(std::memory_order_acquire) || std::this_thread::get_id() == m_WriterId.load(std::memory_order_relaxed)) return;
+        const std::uint64_t target = m_Tail.load(std::memory_order_acquire);
+        while (m_Completed.load(std::memory_order_acquire) < target) {
+            Wake();
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            if (!m_Running.load(std::memory_order_acquire)) break;
+        }
+    }
+
+    void LogBackend::WriterMain() {
+        Logger* touched[8] = {};
+        for (;;) {
+            std::size_t n = 0, ntouched = 0;
+            Logger* last = nullptr;
+            while (n < kBatch && TryDequeue(true, last)) {
+                ++n;
+                if (last && std::find(touched, touched + ntouched, last) == touched + ntouched) {
+                    if (ntouched < std::size(touched)) touched[ntouched++] = last;
+                    else last->commit_sinks();
+                }
+            }
+            if (n) {
+                for (std::size_t i = 0; i < ntouched; ++i) touched[i]->commit_sinks();
+                const std::uint64_t done = m_Completed.fetch_add(n, std::memory_order_release) + n;
+                FK_PROFILE_COUNTER("Log queue depth", m_Tail.load(std::memory_order_relaxed) - done);
+                (void)done;
+                continue;
+            }
+
+            if (m_Stop.load(std::memory_order_acquire)) {
+                if (Empty()) break;
+                continue;
+            }
+
+            // Producers only notify while we advertise that we are sleeping
+            m_Sleeping.store(true, std::memory_order_seq_cst);
+            bool woken = true;
+            if (Empty()) {
+                std::unique_lock lock(m_WakeMutex);
+                woken = m_WakeCv.wait_for(lock, kIdleWait, [this] { return m_WakeFlag; });
+                m_WakeFlag = false;
+            }
+            m_Sleeping.store(false, std::memory_order_relaxed);
+            if (!woken) Log::CommitSinks(); // quiet period: buffered file lines past their interval go out
+        }
+    }
+
+} // namespace FrameKit
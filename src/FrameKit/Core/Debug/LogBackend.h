@@ -0,0 +1,106 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Debug/LogBackend.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Async log backend (private)
+//      Bounded MPMC ring (Vyukov) of fixed-size records. Producers are the
+//      logging threads; the writer thread is the consumer, and producers also
+//      dequeue when the DropOldest policy has to make room.
+// =============================================================================
+
+#pragma once
+
+#include "FrameKit/Debug/Log.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace FrameKit {
+
+    class LogBackend {
+    public:
+        static LogBackend& Get() noexcept;
+
+        void Start(const AsyncLogSettings& s);
+        void Stop();
+        FK_NODISCARD bool Running() const noexcept { return m_Running.load(std::memory_order_acquire); }
+
+        // False if the backend is not running (the caller writes synchronously).
+        bool Push(Logger* logger, LogLevel lvl, LogModule module, std::int64_t unixNs, std::string_view message) noexcept;
+        // Deferred record: formatted by the writer thread from spec + argument bytes
+        bool PushBinary(Logger* logger, LogLevel lvl, LogModule module, std::int64_t unixNs, const detail::FormatSpec& spec,
+                        const detail::LogArg* kinds, std::size_t argc, const std::byte* data, std::size_t size) noexcept;
+        void Flush();
+
+        FK_NODISCARD std::uint64_t Dropped() const noexcept { return m_Dropped.load(std::memory_order_relaxed); }
+
+    private:
+        static constexpr std::size_t kRecordSize = 256;
+        static constexpr std::size_t kInline = kRecordSize - 64;
+
+        struct alignas(FK_CACHELINE_SIZE) Record {
+            std::atomic<std::uint64_t> seq{ 0 };
+            Logger*                    logger = nullptr;
+            const detail::FormatSpec*  spec = nullptr;    // nullptr => `text` is the finished message
+            const detail::LogArg*      kinds = nullptr;
+            std::string*               spill = nullptr;   // payloads longer than kInline
+            std::int64_t               unixNs = 0;
+            std::uint32_t              len = 0;
+            std::uint16_t              argc = 0;
+            LogLevel                   level = LogLevel::Info;
+            LogModule                  module = LogModule::Core;
+            char                       text[kInline];     // message text or argument bytes
+        };
+        static_assert(sizeof(Record) == kRecordSize, "log record must stay a fixed size");
+
+        LogBackend() = default;
+        ~LogBackend() = default;
+
+        Record& At(std::uint64_t pos) noexcept { return m_Records[pos & m_Mask]; }
+        struct Payload {
+            const detail::FormatSpec* spec;
+            const detail::LogArg*     kinds;
+            std::size_t               argc;
+            const void*               data;
+            std::size_t               size;
+        };
+        bool Enqueue(Logger* logger, LogLevel lvl, LogModule module, std::int64_t unixNs, const Payload& payload) noexcept;
+        bool TryEnqueue(Logger* logger, LogLevel lvl, LogModule module, std::int64_t unixNs, const Payload& payload) noexcept;
+        // Consumer side; `write` false discards (DropOldest). Returns false if empty.
+        bool TryDequeue(bool write, Logger*& touched) noexcept;
+        bool Empty() noexcept;
+        void Wake() noexcept;
+        void WriterMain();
+
+    private:
+        std::unique_ptr<Record[]>  m_Records;
+        std::uint64_t              m_Mask = 0;
+        LogOverflow                m_Overflow = LogOverflow::Block;
+
+        alignas(FK_CACHELINE_SIZE) std::atomic<std::uint64_t> m_Tail{ 0 };      // producers
+        alignas(FK_CACHELINE_SIZE) std::atomic<std::uint64_t> m_Head{ 0 };      // consumers
+        alignas(FK_CACHELINE_SIZE) std::atomic<std::uint64_t> m_Completed{ 0 }; // written or dropped
+        std::atomic<std::uint64_t> m_Dropped{ 0 };
+
+        std::atomic<bool>          m_Running{ false };
+        std::atomic<bool>          m_Stop{ false };
+        std::atomic<bool>          m_Sleeping{ false };
+        std::mutex                 m_WakeMutex;
+        std::condition_variable    m_WakeCv;
+        bool                       m_WakeFlag = false;
+        std::mutex                 m_ControlMutex;   // Start/Stop
+        std::thread                m_Writer;
+        std::atomic<std::thread::id> m_WriterId{};   // set by the writer itself; only compared with the caller's id
+    };
+
+} // namespace FrameKit
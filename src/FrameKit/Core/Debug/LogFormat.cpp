@@ -0,0 +1,94 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Debug/LogFormat.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Formats deferred log records (FormatSpec + argument bytes)
+// =============================================================================
+
+#include "FrameKit/Debug/LogFormat.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+namespace FrameKit::detail {
+
+    namespace {
+        template<typename R>
+        bool Read(const std::byte*& p, const std::byte* end, R& v) noexcept {
+            if (static_cast<std::size_t>(end - p) < sizeof(R)) return false;
+            std::memcpy(&v, p, sizeof(R));
+            p += sizeof(R);
+            return true;
+        }
+
+        // Appends one argument; false if the bytes are truncated
+        bool AppendArg(std::string& out, LogArg kind, const std::byte*& p, const std::byte* end) {
+            char tmp[32];
+            switch (kind) {
+            case LogArg::Bool: {
+                std::uint8_t v; if (!Read(p, end, v)) return false;
+                out += v ? '1' : '0';   // matches default ostream output
+                return true;
+            }
+            case LogArg::Char: {
+                char v; if (!Read(p, end, v)) return false;
+                out += v;
+                return true;
+            }
+            case LogArg::Int: {
+                std::int64_t v; if (!Read(p, end, v)) return false;
+                out.append(tmp, static_cast<std::size_t>(std::snprintf(tmp, sizeof(tmp), "%" PRId64, v)));
+                return true;
+            }
+            case LogArg::UInt: {
+                std::uint64_t v; if (!Read(p, end, v)) return false;
+                out.append(tmp, static_cast<std::size_t>(std::snprintf(tmp, sizeof(tmp), "%" PRIu64, v)));
+                return true;
+            }
+            case LogArg::Double: {
+                double v; if (!Read(p, end, v)) return false;
+                out.append(tmp, static_cast<std::size_t>(std::snprintf(tmp, sizeof(tmp), "%g", v)));
+                return true;
+            }
+            case LogArg::Pointer: {
+                std::uintptr_t v; if (!Read(p, end, v)) return false;
+                if (v) out.append(tmp, static_cast<std::size_t>(std::snprintf(tmp, sizeof(tmp), "0x%" PRIxPTR, v)));
+                else   out += '0';
+                return true;
+            }
+            case LogArg::String: {
+                std::uint32_t len; if (!Read(p, end, len)) return false;
+                if (static_cast<std::size_t>(end - p) < len) return false;
+                out.append(reinterpret_cast<const char*>(p), len);
+                p += len;
+                return true;
+            }
+            }
+            return false;
+        }
+    }
+
+    void FormatLogArgs(std::string& out, const FormatSpec& spec, const LogArg* kinds, std::size_t argc,
+                       const std::byte* data, std::size_t size) {
+        const std::byte* p = data;
+        const std::byte* end = data + size;
+        std::size_t arg = 0;
+        for (std::uint16_t i = 0; i < spec.count; ++i) {
+            const FormatSegment& s = spec.segments[i];
+            if (s.length != FormatSegment::kArg) {
+                out.append(spec.fmt + s.offset, s.length);
+            }
+            else if (arg < argc && AppendArg(out, kinds[arg], p, end)) {
+                ++arg;
+            }
+            else {
+                out += "{}";
+                arg = argc;
+            }
+        }
+    }
+
+} // namespace FrameKit::detail
@@ -0,0 +1,163 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Debug/LogSink.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Console and buffered, rotating file log sinks.
+// =============================================================================
+
+#include "FrameKit/Engine/PlatformDetection.h"
+#include "FrameKit/Debug/LogSink.h"
+
+#if defined(FK_PLATFORM_WINDOWS)
+    #ifndef NOMINMAX
+    #define NOMINMAX
+    #endif
+    #include <windows.h>
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+namespace FrameKit {
+
+    namespace {
+        std::int64_t unix_now_ns() noexcept {
+            using namespace std::chrono;
+            return duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count();
+        }
+    }
+
+    // ---------------- ConsoleSink ----------------
+
+    ConsoleSink::ConsoleSink() {
+#if defined(FK_PLATFORM_WINDOWS)
+        // Enable ANSI VT once
+        static const bool vtEnabled = [] {
+            if (HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE); hOut != INVALID_HANDLE_VALUE) {
+                DWORD mode = 0;
+                if (GetConsoleMode(hOut, &mode)) {
+                    mode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+                    SetConsoleMode(hOut, mode);
+                }
+            }
+            return true;
+        }();
+        (void)vtEnabled;
+#endif
+    }
+
+    void ConsoleSink::Write(LogLevel level, std::int64_t, std::string_view line) {
+        const char* color = detail::level_to_ansi(level);
+        std::fwrite(color, 1, std::strlen(color), stdout);
+        std::fwrite(line.data(), 1, line.size(), stdout);
+        std::fwrite("\x1b[0m\n", 1, 5, stdout);
+    }
+
+    void ConsoleSink::Flush() { std::fflush(stdout); }
+
+    // ---------------- FileSink ----------------
+
+    FileSink::FileSink(FileSinkSettings settings) : m_Settings(std::move(settings)) {
+        m_Buffer.reserve(m_Settings.bufferBytes);
+        std::scoped_lock lk(m_Mutex);
+        Open(m_Settings.append);
+        if (m_Settings.maxBytes && m_FileBytes >= m_Settings.maxBytes) RotateLocked();
+    }
+
+    FileSink::~FileSink() {
+        std::scoped_lock lk(m_Mutex);
+        Drain();
+    }
+
+    void FileSink::Open(bool append) {
+        // Unbuffered stream: m_Buffer is the only buffer, so each Drain() is one write
+        m_File.rdbuf()->pubsetbuf(nullptr, 0);
+        m_File.open(m_Settings.path, std::ios::out | std::ios::binary | (append ? std::ios::app : std::ios::trunc));
+
+        std::error_code ec;
+        const auto size = append ? std::filesystem::file_size(m_Settings.path, ec) : 0;
+        m_FileBytes = ec ? 0 : static_cast<std::uint64_t>(size);
+        m_OpenedNs = unix_now_ns();
+    }
+
+    void FileSink::Write(LogLevel level, std::int64_t unixNs, std::string_view line) {
+        std::scoped_lock lk(m_Mutex);
+        const std::size_t bytes = line.size() + 1;
+
+        if (m_Settings.rotateIntervalSec &&
+            unixNs - m_OpenedNs >= static_cast<std::int64_t>(m_Settings.rotateIntervalSec) * 1'000'000'000) {
+            Drain();
+            RotateLocked();
+        }
+        if (m_Settings.maxBytes && m_FileBytes + m_Buffer.size() + bytes > m_Settings.maxBytes) {
+            Drain();
+            if (m_FileBytes) RotateLocked();
+        }
+        if (m_Buffer.size() + bytes > m_Settings.bufferBytes) Drain();
+
+        if (m_Buffer.empty()) m_OldestNs = unixNs;
+        m_Buffer.append(line);
+        m_Buffer.push_back('\n');
+        if (level >= m_Settings.flushLevel) m_Urgent = true;
+    }
+
+    void FileSink::Commit() {
+        std::scoped_lock lk(m_Mutex);
+        if (m_Buffer.empty()) return;
+        if (m_Urgent || unix_now_ns() - m_OldestNs >= static_cast<std::int64_t>(m_Settings.flushIntervalMs) * 1'000'000)
+            Drain();
+    }
+
+    void FileSink::Flush() {
+        std::scoped_lock lk(m_Mutex);
+        Drain();
+        m_File.flush();
+    }
+
+    void FileSink::Rotate() {
+        std::scoped_lock lk(m_Mutex);
+        Drain();
+        RotateLocked();
+    }
+
+    void FileSink::Drain() {
+        if (!m_Buffer.empty() && m_File.is_open()) {
+            m_File.write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+            m_FileBytes += m_Buffer.size();
+        }
+        m_Buffer.clear();
+        m_Urgent = false;
+        m_OldestNs = 0;
+    }
+
+    void FileSink::RotateLocked() {
+        m_File.close();
+        std::error_code ec;
+        if (m_Settings.maxFiles == 0) {
+            std::filesystem::remove(m_Settings.path, ec);
+        }
+        else {
+            std::filesystem::remove(RotatedPath(m_Settings.path, m_Settings.maxFiles), ec);
+            for (std::uint32_t i = m_Settings.maxFiles; i > 1; --i)
+                std::filesystem::rename(RotatedPath(m_Settings.path, i - 1), RotatedPath(m_Settings.path, i), ec);
+            std::filesystem::rename(m_Settings.path, RotatedPath(m_Settings.path, 1), ec);
+        }
+        m_File.clear();
+        Open(false);
+    }
+
+    std::string FileSink::RotatedPath(const std::string& path, std::uint32_t index) {
+        const std::filesystem::path p(path);
+        std::filesystem::path rotated = p.parent_path() / p.stem();
+        rotated += "." + std::to_string(index);
+        rotated += p.extension();
+        return rotated.string();
+    }
+
+} // namespace FrameKit
@@ -0,0 +1,114 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Debug/ScopeStats.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Percentiles, interval deltas and reports for scope statistics.
+// =============================================================================
+
+#include "FrameKit/Debug/ScopeStats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+namespace FrameKit {
+
+    namespace {
+        double bucket_upper(std::uint32_t i) noexcept {
+            return (i + 1 < ScopeHistogram::kBuckets)
+                ? static_cast<double>(ScopeHistogram::BucketLower(i + 1))
+                : static_cast<double>(std::numeric_limits<std::uint64_t>::max());
+        }
+
+        // Human-scaled duration, e.g. "850ns", "12.4us", "3.10ms"
+        std::string format_ns(double ns) {
+            char buf[32];
+            if (ns < 1e3)      std::snprintf(buf, sizeof(buf), "%.0fns", ns);
+            else if (ns < 1e6) std::snprintf(buf, sizeof(buf), "%.1fus", ns / 1e3);
+            else if (ns < 1e9) std::snprintf(buf, sizeof(buf), "%.2fms", ns / 1e6);
+            else               std::snprintf(buf, sizeof(buf), "%.2fs", ns / 1e9);
+            return buf;
+        }
+    }
+
+    double ScopeStats::PercentileNs(double q) const noexcept {
+        if (count == 0 || buckets.empty()) return 0.0;
+        q = std::clamp(q, 0.0, 1.0);
+        const auto rank = static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(count)));
+        std::uint64_t seen = 0;
+        for (std::uint32_t i = 0; i < buckets.size(); ++i) {
+            seen += buckets[i];
+            if (seen >= std::max<std::uint64_t>(rank, 1)) {
+                const double mid = (static_cast<double>(ScopeHistogram::BucketLower(i)) + bucket_upper(i)) * 0.5 * nsPerTick;
+                return std::clamp(mid, minNs, maxNs);
+            }
+        }
+        return maxNs;
+    }
+
+    const ScopeStats* ScopeStatsSnapshot::Find(const std::string& name) const noexcept {
+        for (const ScopeStats& s : scopes)
+            if (s.name == name) return &s;
+        return nullptr;
+    }
+
+    ScopeStatsSnapshot ScopeStatsSnapshot::Since(const ScopeStatsSnapshot& earlier) const {
+        ScopeStatsSnapshot out;
+        out.takenNs = takenNs;
+        out.sinceNs = earlier.takenNs;
+        out.frames = frames - std::min(frames, earlier.frames);
+        out.dropped = dropped - std::min(dropped, earlier.dropped);
+
+        for (const ScopeStats& cur : scopes) {
+            ScopeStats d = cur;
+            if (const ScopeStats* old = earlier.Find(cur.name)) {
+                d.count -= std::min(d.count, old->count);
+                d.totalNs = std::max(0.0, d.totalNs - old->totalNs);
+                for (std::size_t i = 0; i < d.buckets.size() && i < old->buckets.size(); ++i)
+                    d.buckets[i] -= std::min(d.buckets[i], old->buckets[i]);
+
+                std::size_t lo = 0, hi = d.buckets.size();
+                while (lo < hi && d.buckets[lo] == 0) ++lo;
+                while (hi > lo && d.buckets[hi - 1] == 0) --hi;
+                if (lo < hi) {
+                    d.minNs = std::max(cur.minNs, static_cast<double>(ScopeHistogram::BucketLower(static_cast<std::uint32_t>(lo))) * d.nsPerTick);
+                    d.maxNs = std::min(cur.maxNs, bucket_upper(static_cast<std::uint32_t>(hi - 1)) * d.nsPerTick);
+                }
+            }
+            if (d.count) out.scopes.push_back(std::move(d));
+        }
+        std::sort(out.scopes.begin(), out.scopes.end(),
+            [](const ScopeStats& a, const ScopeStats& b) { return a.totalNs > b.totalNs; });
+        return out;
+    }
+
+    std::vector<std::string> ScopeStatsSnapshot::FormatReport(std::size_t maxScopes) const {
+        std::vector<std::string> lines;
+        const std::size_t n = std::min(maxScopes, scopes.size());
+        lines.reserve(n);
+        char buf[128];
+        for (std::size_t i = 0; i < n; ++i) {
+            const ScopeStats& s = scopes[i];
+            std::string line = s.name;
+            std::snprintf(buf, sizeof(buf), ": %llu calls", static_cast<unsigned long long>(s.count));
+            line += buf;
+            if (frames) {
+                std::snprintf(buf, sizeof(buf), " (%.2f/frame)", static_cast<double>(s.count) / static_cast<double>(frames));
+                line += buf;
+            }
+            line += " mean " + format_ns(s.MeanNs());
+            line += " p50 " + format_ns(s.PercentileNs(0.50));
+            line += " p99 " + format_ns(s.PercentileNs(0.99));
+            line += " p999 " + format_ns(s.PercentileNs(0.999));
+            line += " max " + format_ns(s.maxNs);
+            line += " total " + format_ns(s.totalNs);
+            lines.push_back(std::move(line));
+        }
+        return lines;
+    }
+
+} // namespace FrameKit
@@ -0,0 +1,125 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Debug/ShmLogSink.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Shared-memory ring log sink and its directory registration.
+// =============================================================================
+
+#include "FrameKit/Engine/PlatformDetection.h"
+#include "FrameKit/Debug/ShmLogSink.h"
+#include "FrameKit/Core/SharedMemory/ShmProcess.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace FrameKit {
+
+    namespace {
+        constexpr std::uint32_t kDirBusy = 0xFFFFFFFFu;   // entry claimed, name not yet written
+
+        std::atomic<std::uint32_t> s_NextSink{ 0 };        // per-process ring suffix
+
+        using SHM::detail::current_pid;
+        using SHM::detail::process_alive;
+
+        void copy_name(char* dst, std::size_t cap, std::string_view src) noexcept {
+            const std::size_t n = std::min(cap - 1, src.size());
+            std::memcpy(dst, src.data(), n);
+            dst[n] = '\0';
+        }
+    }
+
+    ShmLogSink::ShmLogSink(const std::string& label) {
+        const std::uint32_t pid = current_pid();
+        m_Segment = "fk_shm_log_" + std::to_string(pid) + "_" +
+                    std::to_string(s_NextSink.fetch_add(1, std::memory_order_relaxed));
+
+        // No other sink in this process uses our name, so an existing segment
+        // can only be left over from a crashed process with a recycled pid
+        m_Ring = SHM::CreateTyped<ShmLogRing>(m_Segment.c_str(), FKSHM_CreateOnly, &m_Handle);
+        if (!m_Ring) {
+            fk_shm_unlink(m_Segment.c_str());
+            m_Ring = SHM::CreateTyped<ShmLogRing>(m_Segment.c_str(), FKSHM_CreateOnly, &m_Handle);
+        }
+        if (!m_Ring) return;
+
+        m_Ring->version = ShmLogRing::kVersion;
+        m_Ring->pid = pid;
+        copy_name(m_Ring->name, sizeof(m_Ring->name), label);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_Ring->magic = ShmLogRing::kMagic;
+
+        Register();
+    }
+
+    ShmLogSink::~ShmLogSink() {
+        Unregister();
+        if (m_Handle) {   // only ever set for a segment this sink created
+            SHM::Close(m_Handle);
+            fk_shm_unlink(m_Segment.c_str());
+        }
+    }
+
+    void ShmLogSink::Register() {
+        ShmLogDirectory* dir = SHM::CreateTyped<ShmLogDirectory>(kShmLogDirectoryName, FKSHM_OpenOrCreate, &m_DirHandle);
+        if (!dir) return;
+
+        const std::uint32_t self = current_pid();
+        for (ShmLogDirectory::Entry& e : dir->entries) {
+            std::uint32_t cur = e.pid.load(std::memory_order_acquire);
+            if (cur == kDirBusy) continue;
+            // Free slots first; entries of dead processes are reclaimed along the way
+            const bool stale = cur != 0 && cur != self && !process_alive(cur);
+            if (cur != 0 && !stale) continue;
+            if (!e.pid.compare_exchange_strong(cur, kDirBusy, std::memory_order_acq_rel)) continue;
+            if (stale) fk_shm_unlink(e.segment);
+
+            copy_name(e.segment, sizeof(e.segment), m_Segment);
+            e.pid.store(self, std::memory_order_release);
+            m_DirEntry = &e;
+            return;
+        }
+        // Directory full: the ring still works, it just cannot be discovered
+    }
+
+    void ShmLogSink::Unregister() {
+        if (m_DirEntry) {
+            m_DirEntry->pid.store(0, std::memory_order_release);
+            m_DirEntry = nullptr;
+        }
+        SHM::Close(m_DirHandle);
+        m_DirHandle = nullptr;
+    }
+
+    void ShmLogSink::Write(LogLevel level, std::int64_t unixNs, std::string_view line) {
+        if (!m_Ring) return;
+        std::scoped_lock lk(m_Mutex);
+
+        constexpr std::size_t kText = sizeof(ShmLogSlot::text);
+        std::uint64_t n = m_Ring->head.load(std::memory_order_relaxed);
+        std::size_t off = 0;
+        do {
+            const std::size_t chunk = std::min(kText, line.size() - off);
+            ShmLogSlot& slot = m_Ring->slots[n & (ShmLogRing::kSlots - 1)];
+
+            // Seqlock publish: readers copy the slot and retry or skip if the stamp moved
+            slot.stamp.store(2 * n + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.unixNs = unixNs;
+            slot.length = static_cast<std::uint16_t>(chunk);
+            slot.level = level;
+            slot.flags = (off + chunk < line.size()) ? ShmLogSlot::kContinued : 0;
+            std::memcpy(slot.text, line.data() + off, chunk);
+            slot.stamp.store(2 * n + 2, std::memory_order_release);
+
+            off += chunk;
+            ++n;
+        } while (off < line.size());
+
+        m_Ring->head.store(n, std::memory_order_release);
+    }
+
+} // namespace FrameKit
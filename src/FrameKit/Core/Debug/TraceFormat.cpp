@@ -0,0 +1,297 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Debug/TraceFormat.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Chrome JSON and compact binary trace writers, compact reader.
+// =============================================================================
+
+#include "FrameKit/Debug/TraceFormat.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace FrameKit {
+
+    namespace {
+        std::string EscapeForJson(std::string_view s) {
+            std::string out;
+            out.reserve(s.size());
+            for (char c : s) {
+                switch (c) {
+                case '\"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\b': out += "\\b";  break;
+                case '\f': out += "\\f";  break;
+                case '\n': out += "\\n";  break;
+                case '\r': out += "\\r";  break;
+                case '\t': out += "\\t";  break;
+                default:   out += c;      break;
+                }
+            }
+            return out;
+        }
+
+        class ChromeJsonWriter final : public TraceWriter {
+        public:
+            void Begin(std::string& out, std::string_view session) override {
+                out += "{\"otherData\": {\"session\":\"";
+                out += EscapeForJson(session);
+                out += "\"},\"traceEvents\":[{}";
+            }
+
+            void Write(std::string& out, const TraceEvent& e, const void* nameKey) override {
+                // Escape each static name once instead of per event
+                const std::string* name = nullptr;
+                std::string scratch;
+                if (nameKey) {
+                    auto it = m_Escaped.find(nameKey);
+                    if (it == m_Escaped.end()) it = m_Escaped.emplace(nameKey, EscapeForJson(e.name)).first;
+                    name = &it->second;
+                }
+                else {
+                    scratch = EscapeForJson(e.name);
+                    name = &scratch;
+                }
+
+                const double tsUs = static_cast<double>(e.tsNs) / 1000.0;
+                char line[128];
+                switch (e.kind) {
+                case TraceEventKind::Complete:
+                    std::snprintf(line, sizeof(line), ",{\"cat\":\"function\",\"dur\":%.3f,\"name\":\"",
+                        static_cast<double>(e.durNs) / 1000.0);
+                    out += line;
+                    out += *name;
+                    std::snprintf(line, sizeof(line), "\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f}", e.tid, tsUs);
+                    break;
+                case TraceEventKind::Counter:
+                    out += ",{\"name\":\"";
+                    out += *name;
+                    std::snprintf(line, sizeof(line), "\",\"ph\":\"C\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"args\":{\"value\":%.15g}}",
+                        e.tid, tsUs, e.value);
+                    break;
+                case TraceEventKind::Instant:
+                    out += ",{\"name\":\"";
+                    out += *name;
+                    std::snprintf(line, sizeof(line), "\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":%u,\"ts\":%.3f}", e.tid, tsUs);
+                    break;
+                case TraceEventKind::FlowBegin:
+                case TraceEventKind::FlowEnd:
+                    // Flow events attach to the enclosing slice on their thread
+                    std::snprintf(line, sizeof(line), ",{\"cat\":\"flow\",\"id\":%llu,\"name\":\"",
+                        static_cast<unsigned long long>(e.id));
+                    out += line;
+                    out += *name;
+                    std::snprintf(line, sizeof(line), "\",\"ph\":\"%s\",\"pid\":0,\"tid\":%u,\"ts\":%.3f}",
+                        e.kind == TraceEventKind::FlowBegin ? "s" : "f\",\"bp\":\"e", e.tid, tsUs);
+                    break;
+                case TraceEventKind::FrameBegin:
+                case TraceEventKind::FrameEnd:
+                    out += ",{\"cat\":\"frame\",\"name\":\"";
+                    out += *name;
+                    std::snprintf(line, sizeof(line), "\",\"ph\":\"%s\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"args\":{\"frame\":%llu}}",
+                        e.kind == TraceEventKind::FrameBegin ? "B" : "E", e.tid, tsUs, static_cast<unsigned long long>(e.id));
+                    break;
+                }
+                out += line;
+            }
+
+            void End(std::string& out) override { out += "]}"; }
+
+        private:
+            std::unordered_map<const void*, std::string> m_Escaped;
+        };
+
+        class CompactWriter final : public TraceWriter {
+        public:
+            void Begin(std::string& out, std::string_view session) override {
+                out.append(CompactTrace::kMagic, sizeof(CompactTrace::kMagic));
+                out.push_back(static_cast<char>(CompactTrace::kTagSession));
+                PutVarint(out, session.size());
+                out.append(session);
+            }
+
+            void Write(std::string& out, const TraceEvent& e, const void* nameKey) override {
+                const std::uint32_t nameId = Intern(out, e.name, nameKey);
+
+                std::int64_t& last = m_LastTs[e.tid];
+                const std::int64_t dt = e.tsNs - last;
+                last = e.tsNs;
+
+                out.push_back(static_cast<char>(CompactTrace::kTagEvent + static_cast<std::uint8_t>(e.kind)));
+                PutVarint(out, e.tid);
+                PutVarint(out, nameId);
+                PutVarint(out, (static_cast<std::uint64_t>(dt) << 1) ^ static_cast<std::uint64_t>(dt >> 63));
+                switch (e.kind) {
+                case TraceEventKind::Complete:
+                    PutVarint(out, static_cast<std::uint64_t>(std::max<std::int64_t>(e.durNs, 0)));
+                    break;
+                case TraceEventKind::Counter: {
+                    const auto bits = std::bit_cast<std::uint64_t>(e.value);
+                    for (int i = 0; i < 8; ++i) out.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+                    break;
+                }
+                case TraceEventKind::Instant:
+                    break;
+                default:
+                    PutVarint(out, e.id);
+                    break;
+                }
+            }
+
+            void End(std::string&) override {}
+
+        private:
+            static void PutVarint(std::string& out, std::uint64_t v) {
+                while (v >= 0x80) {
+                    out.push_back(static_cast<char>((v & 0x7F) | 0x80));
+                    v >>= 7;
+                }
+                out.push_back(static_cast<char>(v));
+            }
+
+            std::uint32_t Intern(std::string& out, std::string_view name, const void* key) {
+                if (key) {
+                    if (auto it = m_ByKey.find(key); it != m_ByKey.end()) return it->second;
+                }
+                std::uint32_t id;
+                if (auto it = m_ByContent.find(std::string(name)); it != m_ByContent.end()) {
+                    id = it->second;
+                }
+                else {
+                    id = m_NextId++;
+                    m_ByContent.emplace(std::string(name), id);
+                    out.push_back(static_cast<char>(CompactTrace::kTagString));
+                    PutVarint(out, id);
+                    PutVarint(out, name.size());
+                    out.append(name);
+                }
+                if (key) m_ByKey.emplace(key, id);
+                return id;
+            }
+
+            std::unordered_map<const void*, std::uint32_t>   m_ByKey;
+            std::unordered_map<std::string, std::uint32_t>   m_ByContent;
+            std::unordered_map<std::uint32_t, std::int64_t>  m_LastTs;
+            std::uint32_t                                    m_NextId = 0;
+        };
+    } // namespace
+
+    std::unique_ptr<TraceWriter> TraceWriter::Create(TraceFormat format) {
+        if (format == TraceFormat::Compact) return std::make_unique<CompactWriter>();
+        return std::make_unique<ChromeJsonWriter>();
+    }
+
+    const char* TraceWriter::Extension(TraceFormat format) noexcept {
+        return format == TraceFormat::Compact ? ".fktrace" : ".json";
+    }
+
+    // ---------------- CompactTraceReader ----------------
+
+    bool CompactTraceReader::Open(const std::filesystem::path& path) {
+        std::ifstream in(path, std::ios::in | std::ios::binary);
+        if (!in) return false;
+        m_Data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        m_Pos = sizeof(CompactTrace::kMagic);
+        m_Truncated = false;
+        m_Session.clear();
+        m_Names.clear();
+        m_NameIndex.clear();
+        m_LastTs.clear();
+        return m_Data.size() >= m_Pos && std::memcmp(m_Data.data(), CompactTrace::kMagic, m_Pos) == 0;
+    }
+
+    bool CompactTraceReader::ReadVarint(std::uint64_t& v) noexcept {
+        v = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            if (m_Pos >= m_Data.size()) return false;
+            const auto b = static_cast<std::uint8_t>(m_Data[m_Pos++]);
+            v |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+            if (!(b & 0x80)) return true;
+        }
+        return false;
+    }
+
+    bool CompactTraceReader::ReadBytes(std::string_view& s, std::size_t n) noexcept {
+        if (m_Data.size() - m_Pos < n) return false;
+        s = std::string_view(m_Data).substr(m_Pos, n);
+        m_Pos += n;
+        return true;
+    }
+
+    bool CompactTraceReader::Next(TraceEvent& e) {
+        while (m_Pos < m_Data.size()) {
+            if (!ReadRecord(e)) {
+                m_Truncated = true;   // incomplete or unknown record: stop here
+                return false;
+            }
+            if (m_HaveEvent) return true;
+        }
+        return false;
+    }
+
+    bool CompactTraceReader::ReadRecord(TraceEvent& e) {
+        m_HaveEvent = false;
+        const auto tag = static_cast<std::uint8_t>(m_Data[m_Pos++]);
+        std::uint64_t a = 0, b = 0;
+        std::string_view bytes;
+
+        if (tag == CompactTrace::kTagString) {
+            if (!ReadVarint(a) || !ReadVarint(b) || !ReadBytes(bytes, b)) return false;
+            m_Names.emplace_back(bytes);
+            m_NameIndex[a] = m_Names.size() - 1;
+            return true;
+        }
+        if (tag == CompactTrace::kTagSession) {
+            if (!ReadVarint(a) || !ReadBytes(bytes, a)) return false;
+            m_Session.assign(bytes);
+            return true;
+        }
+
+        const unsigned kind = tag - CompactTrace::kTagEvent;
+        if (tag < CompactTrace::kTagEvent || kind > static_cast<unsigned>(TraceEventKind::FrameEnd)) return false;
+        std::uint64_t dt = 0;
+        if (!ReadVarint(a) || !ReadVarint(b) || !ReadVarint(dt)) return false;
+        const auto name = m_NameIndex.find(b);
+        if (name == m_NameIndex.end()) return false;
+
+        TraceEvent ev;
+        ev.kind = static_cast<TraceEventKind>(kind);
+        ev.tid = static_cast<std::uint32_t>(a);
+        ev.name = m_Names[name->second];
+        const std::int64_t delta = static_cast<std::int64_t>(dt >> 1) ^ -static_cast<std::int64_t>(dt & 1);
+        switch (ev.kind) {
+        case TraceEventKind::Complete:
+            if (!ReadVarint(a)) return false;
+            ev.durNs = static_cast<std::int64_t>(a);
+            break;
+        case TraceEventKind::Counter: {
+            if (!ReadBytes(bytes, 8)) return false;
+            std::uint64_t bits = 0;
+            for (int i = 0; i < 8; ++i) bits |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(bytes[i])) << (8 * i);
+            ev.value = std::bit_cast<double>(bits);
+            break;
+        }
+        case TraceEventKind::Instant:
+            break;
+        default:
+            if (!ReadVarint(ev.id)) return false;
+            break;
+        }
+
+        // Only a complete record advances the thread's clock
+        std::int64_t& last = m_LastTs[ev.tid];
+        last += delta;
+        ev.tsNs = last;
+        e = ev;
+        m_HaveEvent = true;
+        return true;
+    }
+
+} // namespace FrameKit
@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Engine/Engine.cpp
 // Author       : George Gil
 // Created      : 2025-09-07
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
 //   Engine-owned entry. Delegates to client CreateApplication and runs the host loop.
@@ -12,18 +12,52 @@
 #include "FrameKit/Core/Engine/Engine.h"
 #include "FrameKit/Application/Application.h"
 #include "FrameKit/Core/Engine/IAppHost.h"
+#include "FrameKit/Engine/JobSystem.h"
 #include "FrameKit/Debug/Log.h"
+#include "FrameKit/Debug/Instrumentor.h"
+#include "FrameKit/Debug/ShmLogSink.h"
 
 namespace FrameKit {
 
     int Engine(ApplicationBase& app)  {
+        Log::SetFileSettings(app.GetSpec().Logging.files);
+        if (app.GetSpec().Logging.async) Log::StartAsync(app.GetSpec().Logging.queue);
         FK_CORE_INFO("Engine start: app='{}' mode={}", app.GetSpec().Name, static_cast<int>(app.GetSpec().Mode));
+        if (app.GetSpec().Logging.sharedMemory) {
+            auto shm = CreateRef<ShmLogSink>(app.GetSpec().Name);
+            if (shm->IsOpen()) {
+                Log::GetCoreLogger()->add_sink(shm);
+                Log::GetClientLogger()->add_sink(shm);
+                FK_CORE_INFO("Shared-memory log: {}", shm->SegmentName());
+            }
+            else {
+                FK_CORE_WARN("Shared-memory log unavailable on this platform or segment creation failed");
+            }
+        }
+
+        const ProfileSettings& prof = app.GetSpec().Profiling;
+#if FK_PROFILE
+        if (prof.flightRecorder) {
+            Instrumentor::Get().StartFlightRecorder(prof.recorder);
+            FK_CORE_INFO("Flight recorder: last {} s into '{}'", prof.recorder.windowSeconds, prof.recorder.directory);
+        }
+        if (prof.scopeStats) {
+            Instrumentor::Get().StartScopeStats(prof.stats);
+            FK_CORE_INFO("Scope statistics: report every {} s", prof.stats.reportIntervalSec);
+        }
+#else
+        if (prof.flightRecorder || prof.scopeStats)
+            FK_CORE_WARN("Profiling requested but profiling scopes are compiled out (configure with FRAMEKIT_PROFILE=ON)");
+#endif
+
+        JobSystem::Get().Init(app.GetSpec().Jobs.workerCount);
 
         auto host = MakeHost(app.GetSpec().Mode);
         if (!host) {
             if (app.GetSpec().Mode == AppMode::Headless) { FK_CORE_ERROR("MakeHost failed: mode=Headless"); }
             else { FK_CORE_ERROR("MakeHost failed: mode=Windowed"); }
             
+            JobSystem::Get().Shutdown();
             app.Shutdown();
             FK_CORE_INFO("Engine stop with code 1");
             return 1;
@@ -31,6 +65,7 @@ namespace FrameKit {
 
         if (!host->Init(app)) {
             FK_CORE_ERROR("Host.Init failed");
+            JobSystem::Get().Shutdown();
             app.Shutdown();
             FK_CORE_INFO("Engine stop with code 1");
             return 1;
@@ -44,7 +79,11 @@ namespace FrameKit {
         }
         FK_CORE_INFO("Host loop exit: frames={}", frames);
 
+        // Finish in-flight async work before the app tears down its layers
+        JobSystem::Get().Shutdown();
         app.Shutdown();
+        if (prof.scopeStats) Instrumentor::Get().StopScopeStats();
+        if (Instrumentor::IsFlightRecording()) Instrumentor::Get().EndSession();
         FK_CORE_INFO("Engine stop with code 0");
         return 0;
     }
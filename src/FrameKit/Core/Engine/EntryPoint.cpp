@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Core/EntryPoint.cpp
 // Author       : George Gil
 // Created      : 2025-09-07
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
 //   Entry point for FrameKit applications. Initializes the application,
@@ -60,6 +60,7 @@ int main(int argc, char** argv) {
     }
 
     FK_PROFILE_END_SESSION();
+    FrameKit::Log::StopAsync(); // writes everything still queued
     FrameKit::Log::UninitClient();
     return exit_code;
 }
\ No newline at end of file
@@ -0,0 +1,103 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Engine/FramePacer.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Hybrid sleep/spin frame pacer with drift-free deadlines, adaptive spin
+//      window and per-window jitter statistics.
+// =============================================================================
+
+#include "FrameKit/Core/Engine/FramePacer.h"
+#include "FrameKit/Utilities/Time.h"
+#include "FrameKit/Debug/Log.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace FrameKit
+{
+    using namespace std::chrono;
+
+    namespace {
+        constexpr nanoseconds kMinSpin = microseconds(50);
+        constexpr nanoseconds kMaxSpin = microseconds(2000);
+        constexpr nanoseconds kDefaultSpin = microseconds(1000);
+    }
+
+    void FramePacer::Configure(double maxFps, std::uint32_t spinWindowUs) {
+        m_Period = (maxFps > 0.0) ? duration_cast<nanoseconds>(duration<double>(1.0 / maxFps)) : nanoseconds{ 0 };
+        m_AdaptiveSpin = (spinWindowUs == 0);
+        m_Spin = m_AdaptiveSpin ? kDefaultSpin : nanoseconds(microseconds(spinWindowUs));
+        m_OvershootEwmaNs = 0.0;
+        m_WindowFrames = (maxFps > 0.0) ? std::max<std::uint32_t>(1u, static_cast<std::uint32_t>(std::lround(maxFps))) : 60u;
+        m_Stats = {};
+        Start();
+    }
+
+    void FramePacer::Start() {
+        m_LastWake = steady::now();
+        m_Deadline = m_LastWake + m_Period;
+        m_WindowCount = 0;
+        m_WindowSumUs = 0.0;
+        m_WindowMaxUs = 0.0;
+    }
+
+    void FramePacer::Wait() {
+        if (!Capped()) {
+            Record(steady::now());
+            return;
+        }
+
+        steady::time_point now = steady::now();
+        if (now < m_Deadline) {
+            // Never spin for more than half a period
+            const nanoseconds spin = std::min(m_Spin, m_Period / 2);
+            const nanoseconds overshoot = SleepUntil(m_Deadline, spin);
+            if (m_AdaptiveSpin && overshoot.count() > 0) {
+                // Fast attack, slow decay: track the tail of the OS wake-up latency
+                const double o = static_cast<double>(overshoot.count());
+                m_OvershootEwmaNs = (o > m_OvershootEwmaNs) ? o : m_OvershootEwmaNs * 0.99 + o * 0.01;
+                const auto target = nanoseconds(static_cast<long long>(m_OvershootEwmaNs * 1.5)) + microseconds(20);
+                m_Spin = std::clamp(target, kMinSpin, kMaxSpin);
+            }
+            now = steady::now();
+        }
+
+        Record(now);
+
+        // Advance on the absolute grid. A frame that is a full period past its
+        // deadline re-anchors instead of bursting to catch up.
+        if (now - m_Deadline >= m_Period) {
+            m_Deadline = now + m_Period;
+            ++m_Stats.missedDeadlines;
+        }
+        else {
+            m_Deadline += m_Period;
+        }
+    }
+
+    void FramePacer::Record(steady::time_point now) {
+        const double periodUs = duration<double, std::micro>(now - m_LastWake).count();
+        m_LastWake = now;
+
+        m_Stats.periodUs = periodUs;
+        m_Stats.spinWindowUs = duration<double, std::micro>(m_Spin).count();
+        if (!Capped()) return;
+
+        const double jitter = periodUs - duration<double, std::micro>(m_Period).count();
+        m_Stats.jitterUs = jitter;
+
+        m_WindowSumUs += std::abs(jitter);
+        m_WindowMaxUs = std::max(m_WindowMaxUs, std::abs(jitter));
+        if (++m_WindowCount >= m_WindowFrames) {
+            m_Stats.jitterMeanUs = m_WindowSumUs / m_WindowCount;
+            m_Stats.jitterMaxUs = m_WindowMaxUs;
+            m_WindowCount = 0;
+            m_WindowSumUs = 0.0;
+            m_WindowMaxUs = 0.0;
+        }
+    }
+} // namespace FrameKit
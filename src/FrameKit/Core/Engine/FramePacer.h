@@ -0,0 +1,70 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Engine/FramePacer.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Frame-rate limiter for the host loops. Deadlines advance by a fixed period
+//      on absolute steady_clock time points, so error does not accumulate; each
+//      wait sleeps coarsely and spins the last stretch (see SleepUntil).
+//      Spinning cannot beat preemption: on a loaded or single-core machine the
+//      tail of the period distribution is set by the OS scheduler.
+// =============================================================================
+
+#pragma once
+
+#include "FrameKit/Engine/Defines.h"
+
+#include <chrono>
+#include <cstdint>
+
+namespace FrameKit
+{
+    struct FramePacerStats {
+        double             periodUs = 0.0;       // last measured frame period
+        double             jitterUs = 0.0;       // last period - target period
+        double             jitterMeanUs = 0.0;   // mean |jitter| over the last window (~1 s)
+        double             jitterMaxUs = 0.0;    // max |jitter| over the last window
+        double             spinWindowUs = 0.0;   // current spin phase length
+        unsigned long long missedDeadlines = 0;  // frames that started a full period late
+    };
+
+    class FramePacer
+    {
+    public:
+        using steady = std::chrono::steady_clock;
+
+        // maxFps <= 0 => uncapped (periods are still measured).
+        // spinWindowUs == 0 => sized from the measured OS sleep overshoot.
+        void Configure(double maxFps, std::uint32_t spinWindowUs);
+        void Start();
+
+        // Blocks until the next frame deadline and records the frame period.
+        void Wait();
+
+        FK_NODISCARD bool Capped() const noexcept { return m_Period.count() > 0; }
+        FK_NODISCARD const FramePacerStats& Stats() const noexcept { return m_Stats; }
+
+    private:
+        void Record(steady::time_point now);
+
+    private:
+        std::chrono::nanoseconds m_Period{ 0 };
+        std::chrono::nanoseconds m_Spin{ 0 };
+        bool                     m_AdaptiveSpin = true;
+        double                   m_OvershootEwmaNs = 0.0;
+
+        steady::time_point       m_Deadline{};
+        steady::time_point       m_LastWake{};
+
+        // Current stats window
+        std::uint32_t            m_WindowFrames = 60;
+        std::uint32_t            m_WindowCount = 0;
+        double                   m_WindowSumUs = 0.0;
+        double                   m_WindowMaxUs = 0.0;
+
+        FramePacerStats          m_Stats{};
+    };
+} // namespace FrameKit
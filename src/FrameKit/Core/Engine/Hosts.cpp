@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Engine/Host.cpp
 // Author       : George Gil
 // Created      : 2025-09-07
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
 //      Implements application hosts (Windowed and Headless) for the FrameKit framework.
@@ -12,9 +12,13 @@
 // =============================================================================
 
 #include "IAppHost.h"
+#include "FramePacer.h"
 #include "FrameKit/Application/Application.h"
+#include "FrameKit/Engine/JobSystem.h"
 #include "FrameKit/Utilities/Time.h"
 #include "FrameKit/Window/IWindow.h"
+#include "FrameKit/Events/GlobalEventHandler.h"
+#include "FrameKit/Events/EventRecorder.h"
 #include "FrameKit/Window/WindowEventBridge.h"
 #include "FrameKit/Gfx/API/RendererConfig.h"
 #include "FrameKit/Debug/Log.h"
@@ -22,8 +26,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <thread>
 #include <memory>
+#include <mutex>
 #include <iostream>
 #if __cpp_lib_format >= 202106L
 #include <format>
@@ -42,32 +48,273 @@ namespace FrameKit {
         using steady = std::chrono::steady_clock;
 
         Timestep                target_dt{};   // 0 => uncapped
+        FramePacer              pacer{};
         steady::time_point      frame_start{};
         Clock                   clock{};       // provides per-frame delta and total
         unsigned long long      frame = 0;
         bool                    closing = false;
+        bool                    async_enabled = false;
+        JobHandle               async_job{};   // in-flight OnAsyncUpdate pass
+        std::uint64_t           async_kicks = 0;   // flow ids for the trace
+
+        // Fixed-step accumulator (fixed_dt == 0 => disabled)
+        double                  fixed_dt = 0.0;
+        double                  max_delta = 0.25;
+        std::uint32_t           max_steps = 8;
+        double                  accumulator = 0.0;
+        unsigned                fixed_steps = 0;     // last frame
+        unsigned long long      dropped_steps = 0;   // total
+        bool                    fixed_behind = false;
+
+        // Idle mode (windowed, IdlePolicy::WaitEvents)
+        bool                    idle_wait = false;
+        double                  idle_timeout = 0.0;          // seconds, 0 => none
+        steady::duration        idle_async_period{};         // 0 => async only with frames
+        steady::time_point      last_async_kick{};
+        ApplicationBase*        waker_app = nullptr;
+
+        // Event delivery
+        GlobalEventHandler::ListenerId app_listener = 0;
+        std::unique_ptr<EventRecorder> recorder;
+        std::unique_ptr<EventReplayer> replayer;
+        Timestep                replay_dt{};
+        steady::time_point      replay_start{};
+
+        // Flight recorder trigger (0 => off)
+        steady::duration        frame_budget{};
+
+        ~CommonLoop() {
+            InstallWaker(nullptr, nullptr);
+            if (app_listener) GlobalEventHandler::Get().Unsubscribe(app_listener);
+            if (recorder) SetWindowInputTap({});
+        }
+
+        void SetupEvents(ApplicationBase& app, const EventSettings& s) {
+            auto& events = GlobalEventHandler::Get();
+            if (s.deferred) {
+                events.SetArenaCapacity(s.arenaBytes);
+                events.SetMode(GlobalEventHandler::Mode::Deferred);
+            }
+            else {
+                events.SetMode(GlobalEventHandler::Mode::Immediate);
+            }
+            app_listener = events.SubscribeAll(EventDelegate{ [](void* ctx, Event& e) {
+                auto& a = *static_cast<ApplicationBase*>(ctx);
+                a.OnEvent(e);
+                if (!e.Handled) a.OnUnhandledEvent(e);
+            }, &app });
+            FK_LOG_INFO(Host, "Event delivery: {}", s.deferred ? "deferred (drained per frame)" : "immediate");
+
+            if (!s.recordPath.empty()) {
+                recorder = std::make_unique<EventRecorder>();
+                if (recorder->Open(s.recordPath)) {
+                    SetWindowInputTap(EventDelegate{ [](void* ctx, Event& e) {
+                        static_cast<EventRecorder*>(ctx)->Record(e);
+                    }, recorder.get() });
+                }
+                else {
+                    recorder.reset();
+                }
+            }
+        }
 
-        void SetupTarget(double max_fps) {
+        // Headless only: frames come from the recording, as fast as possible
+        bool SetupReplay(const EventSettings& s) {
+            if (s.replayPath.empty()) return true;
+            replayer = std::make_unique<EventReplayer>();
+            if (!replayer->Open(s.replayPath)) return false;
+            target_dt = Timestep{};
+            pacer.Configure(0.0, 0);
+            replay_start = steady::now();
+            return true;
+        }
+
+        // Replay: posts the next recorded frame's events. False at end of stream.
+        bool ReplayFrame() {
+            if (!replayer) return true;
+            if (replayer->NextFrame(replay_dt)) return true;
+
+            const double secs = std::chrono::duration<double>(steady::now() - replay_start).count();
+            FK_LOG_INFO(Host, "Replay finished: {} frames, {} events in {} ms ({} fps)",
+                replayer->Frames(), replayer->Events(), static_cast<long long>(secs * 1000.0),
+                secs > 0.0 ? static_cast<long long>(static_cast<double>(replayer->Frames()) / secs) : 0LL);
+            return false;
+        }
+
+        // Frame delta for this frame: recorded while replaying, measured otherwise
+        Timestep NextDelta() {
+            clock.Tick();
+            const Timestep ts = replayer ? replay_dt : clock.Delta();
+            if (recorder) recorder->EndFrame(ts);
+            return ts;
+        }
+
+        // Deferred mode: deliver everything queued since the last frame
+        void DrainEvents() {
+            FK_PROFILE_FUNCTION();
+            const std::size_t delivered = GlobalEventHandler::Get().Drain();
+            FK_PROFILE_COUNTER("Events/frame", delivered);
+            (void)delivered;
+        }
+
+        void SetupTarget(const LoopSettings& s) {
+            const double max_fps = s.maxFps;
             target_dt = (max_fps > 0.0) ? Timestep(static_cast<float>(1.0 / max_fps)) : Timestep{};
+            pacer.Configure(max_fps, s.spinWindowUs);
             frame = 0;
             closing = false;
             frame_start = steady::now();
-            FK_CORE_INFO("Loop target: {}", (max_fps > 0.0) ? std::to_string(max_fps) + " fps" : "uncapped");
+            FK_LOG_INFO(Host, "Loop target: {}", (max_fps > 0.0) ? std::to_string(max_fps) + " fps" : "uncapped");
+        }
 
+        void SetupProfiling(const ProfileSettings& s) {
+            frame_budget = (s.frameBudgetMs > 0.0)
+                ? std::chrono::duration_cast<steady::duration>(std::chrono::duration<double, std::milli>(s.frameBudgetMs))
+                : steady::duration{};
         }
 
-        bool PaceAndEndFrame(ApplicationBase& app) {
+        void SetupFixed(const LoopSettings& s) {
+            fixed_dt = (s.fixedUpdateHz > 0.0) ? 1.0 / s.fixedUpdateHz : 0.0;
+            max_delta = (s.maxFrameDelta > 0.0) ? s.maxFrameDelta : 0.25;
+            max_steps = std::max<std::uint32_t>(1u, s.maxFixedSteps);
+            accumulator = 0.0;
+            if (fixed_dt > 0.0) {
+                FK_LOG_INFO(Host, "Fixed step: {} Hz, max {} steps/frame, max frame delta {} s",
+                    s.fixedUpdateHz, max_steps, max_delta);
+            }
+        }
+
+        // Feeds the frame delta into the accumulator and runs OnFixedUpdate for
+        // every whole step it holds, up to max_steps. Remaining whole steps are
+        // dropped so a slow frame cannot snowball into ever slower frames.
+        void StepFixed(ApplicationBase& app, Timestep ts) {
+            fixed_steps = 0;
+            if (fixed_dt <= 0.0) return;
+
             FK_PROFILE_FUNCTION();
-            if (target_dt.Seconds() > 0.0f) {
-                auto spent = Timestep(std::chrono::duration<float>(steady::now() - frame_start));
-                auto remain = target_dt - spent;
-                if (remain.Seconds() > 0.0f) {
-                    Sleep(remain);
+            accumulator += std::min(static_cast<double>(ts.Seconds()), max_delta);
+            const Timestep step(static_cast<float>(fixed_dt));
+            app.m_FixedTimestep = step;
+
+            while (accumulator >= fixed_dt && fixed_steps < max_steps) {
+                app.OnFixedUpdate(step);
+                accumulator -= fixed_dt;
+                ++fixed_steps;
+            }
+            const bool behind = accumulator >= fixed_dt;
+            if (behind) {
+                const auto dropped = static_cast<unsigned long long>(accumulator / fixed_dt);
+                accumulator -= static_cast<double>(dropped) * fixed_dt;
+                dropped_steps += dropped;
+            }
+            if (behind != fixed_behind) {
+                fixed_behind = behind;
+                if (behind) FK_LOG_WARN(Host, "Fixed step falling behind: dropping steps (total {})", dropped_steps);
+                else        FK_LOG_INFO(Host, "Fixed step caught up (dropped {} in total)", dropped_steps);
+            }
+            app.m_InterpolationAlpha = static_cast<float>(accumulator / fixed_dt);
+        }
+
+        void FillStats(HostStats& stats, Timestep ts) const {
+            stats.ts = ts.Seconds();
+            stats.frame = frame + 1;
+            stats.alpha = (fixed_dt > 0.0) ? accumulator / fixed_dt : 0.0;
+            stats.fixedSteps = fixed_steps;
+            stats.droppedSteps = dropped_steps;
+
+            const FramePacerStats& p = pacer.Stats();
+            stats.periodUs = p.periodUs;
+            stats.jitterUs = p.jitterUs;
+            stats.jitterMeanUs = p.jitterMeanUs;
+            stats.jitterMaxUs = p.jitterMaxUs;
+            stats.missedDeadlines = p.missedDeadlines;
+        }
+
+        void BeginFrame(ApplicationBase& app) {
+            frame_start = steady::now();
+            FK_PROFILE_FRAME_BEGIN(frame);
+            if (frame == 0) pacer.Start(); // anchor deadlines after app.Init()
+            KickAsync(app);
+        }
+
+        void SetupIdle(ApplicationBase& app, const LoopSettings& s) {
+            idle_wait = (s.idlePolicy == IdlePolicy::WaitEvents);
+            idle_timeout = std::max(0.0, s.idleTimeout);
+            idle_async_period = (s.idleAsyncHz > 0.0)
+                ? std::chrono::duration_cast<steady::duration>(std::chrono::duration<double>(1.0 / s.idleAsyncHz))
+                : steady::duration{};
+            waker_app = &app;
+            if (idle_wait) {
+                FK_LOG_INFO(Host, "Idle policy: WaitEvents (timeout={} s, async={} Hz)", idle_timeout, s.idleAsyncHz);
+            }
+        }
+
+        // Installs (fn != nullptr) or removes the callback RequestRedraw() and
+        // deferred posts from other threads use to break the host out of its
+        // idle wait.
+        void InstallWaker(void (*fn)(void*), void* ctx) {
+            if (!waker_app) return;
+            {
+                std::scoped_lock<std::mutex> lock(waker_app->m_WakeMutex);
+                waker_app->m_WakeFn = fn;
+                waker_app->m_WakeCtx = ctx;
+            }
+            GlobalEventHandler::Get().SetWaker(fn, ctx);
+        }
+
+        // True if a redraw was requested or a RequestRedrawIn() deadline passed.
+        bool ConsumeRedraw(ApplicationBase& app, steady::time_point now) {
+            bool redraw = app.m_RedrawRequested.exchange(false, std::memory_order_acq_rel);
+            const std::int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+            std::int64_t due = app.m_RedrawDeadlineNs.load(std::memory_order_acquire);
+            while (due <= now_ns) {
+                if (app.m_RedrawDeadlineNs.compare_exchange_weak(due, INT64_MAX, std::memory_order_acq_rel)) {
+                    redraw = true;
+                    break;
                 }
-                else if (remain.Seconds() < -0.010f) {
-                    FK_CORE_WARN("Frame over budget: {} ms", -remain.Milliseconds());
+            }
+            return redraw;
+        }
+
+        static steady::time_point RedrawDeadline(const ApplicationBase& app) {
+            const std::int64_t due = app.m_RedrawDeadlineNs.load(std::memory_order_acquire);
+            if (due == INT64_MAX) return steady::time_point::max();
+            return steady::time_point(std::chrono::duration_cast<steady::duration>(std::chrono::nanoseconds(due)));
+        }
+
+        // Starts one async layer pass unless the previous one is still running.
+        void KickAsync(ApplicationBase& app) {
+            if (!async_enabled || !async_job.IsDone()) return;
+            FK_PROFILE_FUNCTION();
+            last_async_kick = steady::now();
+            const std::uint64_t flow = ++async_kicks;
+            FK_PROFILE_FLOW_BEGIN("OnAsyncUpdate", flow);
+            async_job = JobSystem::Get().Schedule([&app, flow] {
+                FK_PROFILE_SCOPE("ApplicationBase::OnAsyncUpdate");
+                FK_PROFILE_FLOW_END("OnAsyncUpdate", flow);
+                (void)flow;
+                app.OnAsyncUpdate();
+            });
+        }
+
+        bool PaceAndEndFrame(ApplicationBase& app) {
+            {
+                FK_PROFILE_FUNCTION();
+                const steady::duration elapsed = steady::now() - frame_start;
+                // Work done this frame, before pacing; the dump runs on the recorder thread
+                if (frame_budget.count() > 0 && elapsed > frame_budget && Instrumentor::IsFlightRecording())
+                    Instrumentor::Get().RequestFlightDump("slow-frame");
+                if (pacer.Capped()) {
+                    auto spent = Timestep(std::chrono::duration<float>(elapsed));
+                    auto remain = target_dt - spent;
+                    if (remain.Seconds() < -0.010f) {
+                        FK_LOG_WARN(Host, "Frame over budget: {} ms", -remain.Milliseconds());
+                    }
                 }
+                pacer.Wait();
             }
+            // After the scope above closes, so the frame marker encloses it
+            FK_PROFILE_FRAME_END(frame);
             ++frame;
             app.OnFrameEnd();
             return !closing;
@@ -76,6 +323,7 @@ namespace FrameKit {
 
     // ---------------- Windowed host ----------------
     class WindowedHost final : public IAppHost {
+        WindowEventBridge bridge_;                 // declared first: outlives the window's callbacks
         WindowPtr win_{ nullptr, &NoopDelete };
         CommonLoop loop_;
         HostStats stats_{};
@@ -83,7 +331,15 @@ namespace FrameKit {
         bool Init(ApplicationBase& app) override {
             FK_PROFILE_FUNCTION();
             const auto& spec = app.GetSpec();
-            loop_.SetupTarget(0.0); // uncapped for now; wire max FPS from spec later
+            loop_.SetupTarget(spec.Loop);
+            loop_.SetupFixed(spec.Loop);
+            loop_.SetupProfiling(spec.Profiling);
+            loop_.SetupIdle(app, spec.Loop);
+            loop_.SetupEvents(app, spec.Events);
+            if (!spec.Events.replayPath.empty()) {
+                FK_LOG_WARN(Host, "Event replay is only supported by the headless host; ignoring '{}'", spec.Events.replayPath);
+            }
+            loop_.async_enabled = spec.Jobs.asyncLayerUpdate;
 
             //RegisterBuiltInWindowBackends();
 			// optionally load window backends from plugins
@@ -92,14 +348,14 @@ namespace FrameKit {
             auto v = ListWindowBackends();
 
             if (v.empty()) {
-                FK_CORE_WARN("Window Backends: none registered");
+                FK_LOG_WARN(Host, "Window Backends: none registered");
             }
             else {
-                FK_CORE_INFO("Window Backends available: {}", v.size());
+                FK_LOG_INFO(Host, "Window Backends available: {}", v.size());
                 for (const WindowAPIInfo& b : v) {
-                    FK_CORE_INFO("Backend: api={} prio={}", ToString(b.id), b.priority);
+                    FK_LOG_INFO(Host, "Backend: api={} prio={}", ToString(b.id), b.priority);
                 }
-                FK_CORE_INFO("Requested API: {}", ToString(spec.WinSettings.api));
+                FK_LOG_INFO(Host, "Requested API: {}", ToString(spec.WinSettings.api));
             }
 
             WindowDesc wd;
@@ -111,11 +367,11 @@ namespace FrameKit {
             wd.resizable = spec.WinSettings.resizable;
             wd.highDPI = spec.WinSettings.highDPI;
 
-            FK_CORE_INFO("Create window: '{}' {}x{} vsync={} resizable={} highDPI={}",
+            FK_LOG_INFO(Host, "Create window: '{}' {}x{} vsync={} resizable={} highDPI={}",
                 wd.title, wd.width, wd.height, wd.vsync, wd.resizable, wd.highDPI);
 
-            FK_CORE_INFO("RendererConfig: api={}", ToString(spec.GfxSettings.api));
-            FK_CORE_INFO("OpenGL Options: major={} minor={} core={} debug={} swapInterval={}",
+            FK_LOG_INFO(Host, "RendererConfig: api={}", ToString(spec.GfxSettings.api));
+            FK_LOG_INFO(Host, "OpenGL Options: major={} minor={} core={} debug={} swapInterval={}",
                 spec.GfxSettings.gl.major,
                 spec.GfxSettings.gl.minor,
                 spec.GfxSettings.gl.core ? "true" : "false",
@@ -125,19 +381,26 @@ namespace FrameKit {
             // pick best available backend
             WindowPtr w = CreateWindow(spec.WinSettings.api, wd, &spec.GfxSettings);
             if (!w) {
-                FK_CORE_ERROR("CreateWindow failed for api={}", ToString(spec.WinSettings.api));
+                FK_LOG_ERROR(Host, "CreateWindow failed for api={}", ToString(spec.WinSettings.api));
                 return false;
             }
             win_ = std::move(w);
-            BindWindowToGlobalEvents(*win_);
-            FK_CORE_TRACE("Window created and event bridge bound");
+            WindowEventBridge::Settings bs;
+            bs.coalesceMouseMove = spec.Events.coalesceMouseMove;
+            bs.coalesceScroll = spec.Events.coalesceScroll;
+            bs.keepMoveHistory = spec.Events.mouseMoveHistory;
+            bridge_.Bind(*win_, bs);
+            if (loop_.idle_wait) {
+                loop_.InstallWaker([](void* ctx) { static_cast<IWindow*>(ctx)->postEmptyEvent(); }, win_.get());
+            }
+            FK_LOG_TRACE(Host, "Window created and event bridge bound");
 
             const bool ok = app.Init();
             if (!ok) {
-                FK_CORE_ERROR("Application Init failed");
+                FK_LOG_ERROR(Host, "Application Init failed");
             }
             else {
-                FK_CORE_INFO("Application Init ok");
+                FK_LOG_INFO(Host, "Application Init ok");
             }
             return ok;
         }
@@ -146,31 +409,38 @@ namespace FrameKit {
             FK_PROFILE_FUNCTION();
             if (loop_.closing) return false;
 
+            app.SyncLayerStack();
             app.OnBeforePoll();
             if (!win_) {
-                FK_CORE_ERROR("Tick: window invalid");
+                FK_LOG_ERROR(Host, "Tick: window invalid");
                 app.OnAfterPoll();
                 loop_.closing = true;
                 return false;
             }
 
-            win_->poll();
+            if (loop_.idle_wait && loop_.frame > 0) {
+                if (WaitForWork(app)) loop_.pacer.Start(); // slept: do not count the gap as a missed deadline
+            }
+            else {
+                win_->poll();
+            }
+            bridge_.Flush();
+            loop_.DrainEvents();
             if (win_->shouldClose()) {
-                FK_CORE_INFO("Window requested close");
+                FK_LOG_INFO(Host, "Window requested close");
                 app.OnAfterPoll();
                 loop_.closing = true;
                 return false;
             }
             app.OnAfterPoll();
 
-            loop_.frame_start = CommonLoop::steady::now();
-            loop_.clock.Tick();
-            Timestep ts = loop_.clock.Delta();
-            if (ts.Seconds() <= 0.0f) ts = Timestep(1.0f / 60.0f);
+            loop_.BeginFrame(app);
+            const Timestep ts = loop_.NextDelta(); // 0 while the clock is paused
 
             app.OnBeforeUpdate(ts);
+            loop_.StepFixed(app, ts);
             if (!app.OnUpdate(ts)) {
-                FK_CORE_INFO("App requested shutdown from OnUpdate");
+                FK_LOG_INFO(Host, "App requested shutdown from OnUpdate");
                 loop_.closing = true;
             }
             app.OnAfterUpdate(ts);
@@ -181,18 +451,60 @@ namespace FrameKit {
                 app.OnAfterRender();
             }
 
-            stats_.ts = ts.Seconds();
-            stats_.frame = loop_.frame + 1;
+            loop_.FillStats(stats_, ts);
 
             if (win_) win_->Swap();
 
             return loop_.PaceAndEndFrame(app);
         }
 
+        // Idle mode: blocks in the window's event wait until input arrives, a
+        // redraw is requested or due, or the idle timeout expires. Meanwhile the
+        // async layer pass keeps its own cadence so addon cyclic work continues.
+        // Returns true if it actually waited.
+        bool WaitForWork(ApplicationBase& app) {
+            FK_PROFILE_FUNCTION();
+            using steady = CommonLoop::steady;
+            const steady::time_point idle_since = loop_.frame_start;
+            const steady::time_point idle_end = (loop_.idle_timeout > 0.0)
+                ? idle_since + std::chrono::duration_cast<steady::duration>(std::chrono::duration<double>(loop_.idle_timeout))
+                : steady::time_point::max();
+            bool waited = false;
+
+            for (;;) {
+                steady::time_point now = steady::now();
+                if (loop_.ConsumeRedraw(app, now) || now >= idle_end) {
+                    if (!waited) win_->poll();
+                    return waited;
+                }
+
+                steady::time_point until = std::min(idle_end, CommonLoop::RedrawDeadline(app));
+                if (loop_.async_enabled && loop_.idle_async_period.count() > 0) {
+                    steady::time_point next_async = loop_.last_async_kick + loop_.idle_async_period;
+                    if (now >= next_async) {
+                        loop_.KickAsync(app);
+                        next_async = now + loop_.idle_async_period;
+                    }
+                    until = std::min(until, next_async);
+                }
+
+                const double timeout = (until == steady::time_point::max())
+                    ? -1.0 : std::max(0.0, std::chrono::duration<double>(until - now).count());
+                waited = true;
+                if (win_->waitEvents(timeout)) {              // input or wake-up
+                    loop_.ConsumeRedraw(app, steady::now());  // served by the frame about to run
+                    return true;
+                }
+            }
+        }
+
         void SignalClose() override {
-            FK_CORE_INFO("SignalClose");
+            FK_LOG_INFO(Host, "SignalClose");
             loop_.closing = true;
-            if (win_) win_->requestClose();
+            if (win_) {
+                win_->requestClose();
+                win_->postEmptyEvent(); // leave an idle wait
+            }
         }
         HostStats Stats() const override { return stats_; }
     };
@@ -203,45 +515,56 @@ namespace FrameKit {
         HostStats stats_{};
     public:
         bool Init(ApplicationBase& app) override {
-            loop_.SetupTarget(0.0);
+            loop_.SetupTarget(app.GetSpec().Loop);
+            loop_.SetupFixed(app.GetSpec().Loop);
+            loop_.SetupProfiling(app.GetSpec().Profiling);
+            loop_.SetupEvents(app, app.GetSpec().Events);
+            if (!loop_.SetupReplay(app.GetSpec().Events)) return false;
+            loop_.async_enabled = app.GetSpec().Jobs.asyncLayerUpdate;
             const bool ok = app.Init();
-            if (!ok) FK_CORE_ERROR("Headless: Application Init failed");
-            else     FK_CORE_INFO("Headless: Application Init ok");
+            if (!ok) FK_LOG_ERROR(Host, "Headless: Application Init failed");
+            else     FK_LOG_INFO(Host, "Headless: Application Init ok");
             return ok;
         }
 
         bool Tick(ApplicationBase& app) override {
             if (loop_.closing) return false;
 
+            app.SyncLayerStack();
             app.OnBeforePoll();
+            if (!loop_.ReplayFrame()) {
+                app.OnAfterPoll();
+                loop_.closing = true;
+                return false;
+            }
+            loop_.DrainEvents(); // events posted from other threads (and replayed ones)
             app.OnAfterPoll();
 
-            loop_.frame_start = CommonLoop::steady::now();
-            loop_.clock.Tick();
-            Timestep ts = loop_.clock.Delta();
+            loop_.BeginFrame(app);
+            const Timestep ts = loop_.NextDelta();
 
             app.OnBeforeUpdate(ts);
+            loop_.StepFixed(app, ts);
             if (!app.OnUpdate(ts)) {
-                FK_CORE_INFO("Headless: App requested shutdown from OnUpdate");
+                FK_LOG_INFO(Host, "Headless: App requested shutdown from OnUpdate");
                 loop_.closing = true;
             }
             app.OnAfterUpdate(ts);
 
-            stats_.ts = ts.Seconds();
-            stats_.frame = loop_.frame + 1;
+            loop_.FillStats(stats_, ts);
 
             return loop_.PaceAndEndFrame(app);
         }
 
-        void SignalClose() override { FK_CORE_INFO("Headless SignalClose"); loop_.closing = true; }
+        void SignalClose() override { FK_LOG_INFO(Host, "Headless SignalClose"); loop_.closing = true; }
         HostStats Stats() const override { return stats_; }
     };
 
     // Factory used by Engine
     std::unique_ptr<IAppHost> MakeHost(AppMode mode) {
         FK_PROFILE_FUNCTION();
-        if (mode == AppMode::Headless) { FK_CORE_INFO("MakeHost: mode=Headless"); }
-        else { FK_CORE_INFO("MakeHost: mode=Windowed"); }
+        if (mode == AppMode::Headless) { FK_LOG_INFO(Host, "MakeHost: mode=Headless"); }
+        else { FK_LOG_INFO(Host, "MakeHost: mode=Windowed"); }
         if (mode == AppMode::Windowed) return std::make_unique<WindowedHost>();
         return std::make_unique<HeadlessHost>();
     }
@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Engine/IAppHost.h
 // Author       : George Gil
 // Created      : 2025-09-07
-// Updated      : 2025-09-08
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  :
 //      Defines the IAppHost interface for application hosts in the FrameKit framework.
@@ -20,7 +20,22 @@
 namespace FrameKit {
     class ApplicationBase;
 
-    struct HostStats { double ts = 0.0; unsigned long long frame = 0; };
+    struct HostStats {
+        double             ts = 0.0;
+        unsigned long long frame = 0;
+
+        // Fixed-step mode
+        double             alpha = 0.0;          // interpolation alpha of the last frame
+        unsigned           fixedSteps = 0;       // OnFixedUpdate calls in the last frame
+        unsigned long long droppedSteps = 0;     // steps discarded by the catch-up cap (total)
+
+        // Frame pacing (jitter is only meaningful with LoopSettings::maxFps > 0)
+        double             periodUs = 0.0;       // last measured frame period
+        double             jitterUs = 0.0;       // last period - target period
+        double             jitterMeanUs = 0.0;   // mean |jitter| over the last ~1 s window
+        double             jitterMaxUs = 0.0;    // max |jitter| over the last ~1 s window
+        unsigned long long missedDeadlines = 0;  // frames that started a full period late
+    };
 
     struct IAppHost {
         virtual ~IAppHost() = default;
@@ -0,0 +1,374 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Engine/JobSystem.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Work-stealing job system. Per-worker Chase-Lev deques (owner pushes and
+//      pops at the bottom, thieves take from the top), a mutex-guarded global
+//      queue for external submissions, and continuation lists for dependencies.
+// =============================================================================
+
+#include "FrameKit/Engine/JobSystem.h"
+#include "FrameKit/Debug/Log.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace FrameKit {
+
+    namespace detail {
+        struct Job {
+            JobSystem::JobFn          fn;
+            std::atomic<std::uint32_t> refs{ 1 };
+            std::atomic<std::int32_t>  pending{ 1 };   // unresolved dependencies + 1 while scheduling
+            std::atomic<bool>          done{ false };
+            std::mutex                 mutex;           // guards continuations vs. completion
+            std::vector<Job*>          continuations;   // each entry holds one reference
+        };
+
+        static void AddRef(Job* j) noexcept { j->refs.fetch_add(1, std::memory_order_relaxed); }
+        static void Release(Job* j) noexcept {
+            if (j && j->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete j;
+        }
+    } // namespace detail
+
+    using detail::Job;
+
+    // -------- JobHandle --------
+    JobHandle::JobHandle(const JobHandle& other) noexcept : m_Job(other.m_Job) {
+        if (m_Job) detail::AddRef(m_Job);
+    }
+
+    JobHandle::JobHandle(JobHandle&& other) noexcept : m_Job(other.m_Job) {
+        other.m_Job = nullptr;
+    }
+
+    JobHandle& JobHandle::operator=(const JobHandle& other) noexcept {
+        if (this != &other) {
+            if (other.m_Job) detail::AddRef(other.m_Job);
+            detail::Release(m_Job);
+            m_Job = other.m_Job;
+        }
+        return *this;
+    }
+
+    JobHandle& JobHandle::operator=(JobHandle&& other) noexcept {
+        if (this != &other) {
+            detail::Release(m_Job);
+            m_Job = other.m_Job;
+            other.m_Job = nullptr;
+        }
+        return *this;
+    }
+
+    JobHandle::~JobHandle() { detail::Release(m_Job); }
+
+    bool JobHandle::IsDone() const noexcept {
+        return !m_Job || m_Job->done.load(std::memory_order_acquire);
+    }
+
+    // -------- Worker deque (Chase-Lev, fixed capacity) --------
+    struct JobSystem::Worker {
+        static constexpr std::int64_t kCapacity = 4096; // power of two
+        static constexpr std::int64_t kMask = kCapacity - 1;
+
+        alignas(FK_CACHELINE_SIZE) std::atomic<std::int64_t> top{ 0 };
+        alignas(FK_CACHELINE_SIZE) std::atomic<std::int64_t> bottom{ 0 };
+        alignas(FK_CACHELINE_SIZE) std::atomic<Job*> slots[kCapacity]{};
+        std::thread thread;
+
+        // Owner only. Returns false when full.
+        bool Push(Job* j) noexcept {
+            const std::int64_t b = bottom.load(std::memory_order_relaxed);
+            const std::int64_t t = top.load(std::memory_order_acquire);
+            if (b - t >= kCapacity) return false;
+            slots[b & kMask].store(j, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Owner only.
+        Job* Pop() noexcept {
+            const std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top.load(std::memory_order_relaxed);
+            if (t > b) {
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            Job* j = slots[b & kMask].load(std::memory_order_relaxed);
+            if (t == b) {
+                // Last element: race against thieves
+                if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    j = nullptr;
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+            return j;
+        }
+
+        // Any thread.
+        Job* Steal() noexcept {
+            std::int64_t t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const std::int64_t b = bottom.load(std::memory_order_acquire);
+            if (t >= b) return nullptr;
+            Job* j = slots[t & kMask].load(std::memory_order_relaxed);
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return nullptr;
+            return j;
+        }
+    };
+
+    static thread_local int t_WorkerIndex = -1;
+
+    // -------- JobSystem --------
+    JobSystem& JobSystem::Get() noexcept {
+        static JobSystem instance;
+        return instance;
+    }
+
+    JobSystem::~JobSystem() { Shutdown(); }
+
+    int JobSystem::CurrentWorkerIndex() noexcept { return t_WorkerIndex; }
+
+    void JobSystem::Init(std::uint32_t workerCount) {
+        if (IsRunning()) {
+            FK_LOG_WARN(Jobs, "JobSystem::Init called twice; keeping {} workers", m_Workers.size());
+            return;
+        }
+        if (workerCount == 0) {
+            const unsigned hw = std::thread::hardware_concurrency();
+            workerCount = hw > 1 ? hw - 1 : 1;
+        }
+
+        m_Stop.store(false, std::memory_order_relaxed);
+        m_Workers.clear();
+        m_Workers.reserve(workerCount);
+        for (std::uint32_t i = 0; i < workerCount; ++i) m_Workers.push_back(std::make_unique<Worker>());
+
+        m_Running.store(true, std::memory_order_release);
+        for (std::uint32_t i = 0; i < workerCount; ++i)
+            m_Workers[i]->thread = std::thread([this, i] { WorkerMain(static_cast<int>(i)); });
+
+        FK_LOG_INFO(Jobs, "JobSystem started: workers={}", workerCount);
+    }
+
+    void JobSystem::Shutdown() {
+        if (!IsRunning()) return;
+
+        // Drain with the workers: running jobs may still release continuations
+        // or schedule more, so wait until every enqueued job has finished
+        Drain();
+
+        // From here on Enqueue() runs jobs inline; pick up anything that was
+        // enqueued while the flag flipped
+        m_Stop.store(true, std::memory_order_seq_cst);
+        Drain();
+        {
+            std::lock_guard<std::mutex> lk(m_SleepMutex);
+        }
+        m_SleepCv.notify_all();
+        for (auto& w : m_Workers)
+            if (w->thread.joinable()) w->thread.join();
+
+        m_Running.store(false, std::memory_order_release);
+        m_Workers.clear();
+        FK_LOG_INFO(Jobs, "JobSystem stopped");
+    }
+
+    JobHandle JobSystem::Schedule(JobFn fn) {
+        return Schedule(std::move(fn), std::span<const JobHandle>{});
+    }
+
+    JobHandle JobSystem::Schedule(JobFn fn, const JobHandle& dependency) {
+        return Schedule(std::move(fn), std::span<const JobHandle>(&dependency, 1));
+    }
+
+    JobHandle JobSystem::Schedule(JobFn fn, std::initializer_list<JobHandle> dependencies) {
+        return Schedule(std::move(fn), std::span<const JobHandle>(dependencies.begin(), dependencies.size()));
+    }
+
+    JobHandle JobSystem::Schedule(JobFn fn, std::span<const JobHandle> dependencies) {
+        Job* job = new Job();
+        job->fn = std::move(fn);
+
+        if (!IsRunning()) {
+            // Inline fallback: dependencies were scheduled inline as well, so they are done
+            for (const JobHandle& d : dependencies) Wait(d);
+            detail::AddRef(job);
+            Execute(job);
+            return JobHandle(job);
+        }
+
+        for (const JobHandle& d : dependencies) {
+            Job* dep = d.m_Job;
+            if (!dep) continue;
+            std::lock_guard<std::mutex> lk(dep->mutex);
+            if (dep->done.load(std::memory_order_acquire)) continue;
+            job->pending.fetch_add(1, std::memory_order_relaxed);
+            detail::AddRef(job);
+            dep->continuations.push_back(job);
+        }
+
+        detail::AddRef(job); // reference owned by the queue until executed
+        if (job->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Enqueue(job);
+        }
+        else {
+            detail::Release(job); // a continuation reference takes over
+        }
+        return JobHandle(job);
+    }
+
+    void JobSystem::Drain() {
+        while (m_Outstanding.load(std::memory_order_seq_cst) > 0) {
+            if (Job* j = TryAcquire(t_WorkerIndex)) RunAcquired(j);
+            else std::this_thread::yield();
+        }
+    }
+
+    void JobSystem::Enqueue(Job* job) {
+        m_Outstanding.fetch_add(1, std::memory_order_seq_cst);
+        if (m_Stop.load(std::memory_order_seq_cst)) {
+            // Shutting down: workers no longer pop, so run it here
+            m_Outstanding.fetch_sub(1, std::memory_order_seq_cst);
+            Execute(job);
+            return;
+        }
+        m_Queued.fetch_add(1, std::memory_order_seq_cst);
+
+        const int self = t_WorkerIndex;
+        if (self < 0 || !m_Workers[static_cast<std::size_t>(self)]->Push(job)) {
+            std::lock_guard<std::mutex> lk(m_GlobalMutex);
+            m_Global.push_back(job);
+        }
+
+        if (m_Sleepers.load(std::memory_order_seq_cst) > 0) {
+            {
+                std::lock_guard<std::mutex> lk(m_SleepMutex);
+            }
+            m_SleepCv.notify_one();
+        }
+    }
+
+    Job* JobSystem::PopGlobal() {
+        std::lock_guard<std::mutex> lk(m_GlobalMutex);
+        if (m_GlobalHead >= m_Global.size()) return nullptr;
+        Job* j = m_Global[m_GlobalHead++];
+        if (m_GlobalHead == m_Global.size()) {
+            m_Global.clear();
+            m_GlobalHead = 0;
+        }
+        return j;
+    }
+
+    Job* JobSystem::Steal(int self) {
+        const std::size_t n = m_Workers.size();
+        if (n == 0) return nullptr;
+        // Start after ourselves so victims are spread across workers
+        const std::size_t start = static_cast<std::size_t>(self + 1);
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t v = (start + i) % n;
+            if (static_cast<int>(v) == self) continue;
+            if (Job* j = m_Workers[v]->Steal()) return j;
+        }
+        return nullptr;
+    }
+
+    Job* JobSystem::TryAcquire(int self) {
+        Job* j = nullptr;
+        if (self >= 0) j = m_Workers[static_cast<std::size_t>(self)]->Pop();
+        if (!j) j = PopGlobal();
+        if (!j) j = Steal(self);
+        if (j) m_Queued.fetch_sub(1, std::memory_order_acq_rel);
+        return j;
+    }
+
+    void JobSystem::RunAcquired(Job* job) {
+        Execute(job);   // continuations are enqueued before the count drops
+        m_Outstanding.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    void JobSystem::Execute(Job* job) {
+        try {
+            if (job->fn) job->fn();
+        }
+        catch (const std::exception& e) {
+            FK_LOG_ERROR(Jobs, "Job threw: {}", e.what());
+        }
+        catch (...) {
+            FK_LOG_ERROR(Jobs, "Job threw unknown exception");
+        }
+        job->fn = nullptr; // release captures early
+
+        std::vector<Job*> next;
+        {
+            std::lock_guard<std::mutex> lk(job->mutex);
+            job->done.store(true, std::memory_order_release);
+            next.swap(job->continuations);
+        }
+        for (Job* c : next) {
+            if (c->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                if (IsRunning()) Enqueue(c);      // continuation reference moves to the queue
+                else Execute(c);
+            }
+            else {
+                detail::Release(c);
+            }
+        }
+        detail::Release(job);
+    }
+
+    void JobSystem::Wait(const JobHandle& handle) {
+        while (!handle.IsDone()) {
+            if (Job* j = TryAcquire(t_WorkerIndex)) RunAcquired(j);
+            else std::this_thread::yield();
+        }
+    }
+
+    void JobSystem::WaitAll(std::span<const JobHandle> handles) {
+        for (const JobHandle& h : handles) Wait(h);
+    }
+
+    void JobSystem::ParallelFor(std::size_t count, std::size_t grain, const RangeFn& fn) {
+        if (count == 0) return;
+        if (grain == 0) grain = 1;
+        if (!IsRunning() || count <= grain) {
+            fn(0, count);
+            return;
+        }
+
+        std::vector<JobHandle> handles;
+        handles.reserve((count + grain - 1) / grain);
+        for (std::size_t begin = grain; begin < count; begin += grain) {
+            const std::size_t end = std::min(begin + grain, count);
+            handles.push_back(Schedule([&fn, begin, end] { fn(begin, end); }));
+        }
+        fn(0, grain); // first chunk on the calling thread
+        WaitAll(handles);
+    }
+
+    void JobSystem::WorkerMain(int index) {
+        t_WorkerIndex = index;
+        while (!m_Stop.load(std::memory_order_acquire)) {
+            if (Job* j = TryAcquire(index)) {
+                RunAcquired(j);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lk(m_SleepMutex);
+            m_Sleepers.fetch_add(1, std::memory_order_seq_cst);
+            m_SleepCv.wait(lk, [this] {
+                return m_Queued.load(std::memory_order_seq_cst) > 0 || m_Stop.load(std::memory_order_acquire);
+            });
+            m_Sleepers.fetch_sub(1, std::memory_order_seq_cst);
+        }
+        t_WorkerIndex = -1;
+    }
+
+} // namespace FrameKit
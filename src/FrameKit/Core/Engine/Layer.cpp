@@ -3,17 +3,49 @@
 // File         : src/FrameKit/Engine/Layer.cpp
 // Author       : George Gil
 // Created      : 2025-09-08
-// Updated      : 2025-09-08
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
-// Description  : Implements the Layer base class constructor.
+// Description  : Implements the Layer base class constructor and scheduling declarations.
 // =============================================================================
 
 #include "FrameKit/Engine/Layer.h"
 
+#include <algorithm>
+
 namespace FrameKit
 {
+    // FNV-1a; resource names only need to be stable within one process
+    static std::uint64_t HashResource(std::string_view s) noexcept {
+        std::uint64_t h = 1469598103934665603ull;
+        for (unsigned char c : s) { h ^= c; h *= 1099511628211ull; }
+        return h;
+    }
+
+    static void AddUnique(std::vector<std::uint64_t>& v, std::uint64_t id) {
+        if (std::find(v.begin(), v.end(), id) == v.end()) v.push_back(id);
+    }
+
     Layer::Layer(const std::string& debugName)
         : m_DebugName(debugName)
     {
     }
+
+    void Layer::DeclareRead(std::string_view resource) {
+        AddUnique(m_Reads, HashResource(resource));
+        m_Declared = true;
+        ++m_SchedulingVersion;
+    }
+
+    void Layer::DeclareWrite(std::string_view resource) {
+        AddUnique(m_Writes, HashResource(resource));
+        m_Declared = true;
+        ++m_SchedulingVersion;
+    }
+
+    void Layer::RunAfter(std::string_view layerName) {
+        if (std::find(m_RunAfter.begin(), m_RunAfter.end(), layerName) == m_RunAfter.end())
+            m_RunAfter.emplace_back(layerName);
+        m_Declared = true;
+        ++m_SchedulingVersion;
+    }
 }
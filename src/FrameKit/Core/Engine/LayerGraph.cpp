@@ -0,0 +1,184 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Engine/LayerGraph.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Builds and runs the layer update dependency graph. Undeclared layers are
+//      exclusive and main-thread only; declared layers conflict on shared writes
+//      or read/write pairs.
+//      Cycles introduced by RunAfter() fall back to stack order.
+// =============================================================================
+
+#include "FrameKit/Core/Engine/LayerGraph.h"
+#include "FrameKit/Debug/Log.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace FrameKit
+{
+    namespace {
+        bool Intersects(const std::vector<std::uint64_t>& a, const std::vector<std::uint64_t>& b) {
+            for (std::uint64_t x : a)
+                if (std::find(b.begin(), b.end(), x) != b.end()) return true;
+            return false;
+        }
+
+        bool Conflicts(const Layer& a, const Layer& b) {
+            if (!a.HasSchedulingInfo() || !b.HasSchedulingInfo()) return true;
+            return Intersects(a.GetWrites(), b.GetWrites())
+                || Intersects(a.GetWrites(), b.GetReads())
+                || Intersects(a.GetReads(), b.GetWrites());
+        }
+
+        bool WantsAfter(const Layer& a, const Layer& b) {
+            const auto& ra = a.GetRunAfter();
+            return std::find(ra.begin(), ra.end(), b.GetName()) != ra.end();
+        }
+    }
+
+    void LayerGraph::Update(const std::vector<Layer*>& layers, std::uint64_t stackVersion) {
+        bool dirty = stackVersion != m_StackVersion || layers.size() != m_Nodes.size();
+        for (std::size_t i = 0; !dirty && i < layers.size(); ++i) {
+            dirty = layers[i] != m_Nodes[i].layer
+                 || (layers[i] && layers[i]->GetSchedulingVersion() != m_Versions[i]);
+        }
+        if (!dirty) return;
+
+        m_StackVersion = stackVersion;
+        m_Nodes.clear();
+        m_Versions.clear();
+        for (Layer* l : layers) {
+            Node node;
+            node.layer = l;
+            m_Nodes.push_back(std::move(node));
+            m_Versions.push_back(l ? l->GetSchedulingVersion() : 0u);
+        }
+        Build();
+    }
+
+    void LayerGraph::Build() {
+        const std::uint32_t n = static_cast<std::uint32_t>(m_Nodes.size());
+
+        // Edge j -> i means i waits for j. Implicit conflict edges follow stack
+        // order; explicit RunAfter() edges may point either way.
+        std::vector<std::vector<std::uint32_t>> deps(n);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            const Layer* li = m_Nodes[i].layer;
+            if (!li) continue;
+            for (std::uint32_t j = 0; j < n; ++j) {
+                const Layer* lj = m_Nodes[j].layer;
+                if (i == j || !lj) continue;
+                if ((j < i && Conflicts(*li, *lj)) || WantsAfter(*li, *lj))
+                    deps[i].push_back(j);
+            }
+        }
+
+        // Kahn's algorithm, preferring stack order among ready nodes
+        std::vector<std::uint32_t> indeg(n, 0);
+        std::vector<std::vector<std::uint32_t>> users(n);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            indeg[i] = static_cast<std::uint32_t>(deps[i].size());
+            for (std::uint32_t j : deps[i]) users[j].push_back(i);
+        }
+
+        m_Order.clear();
+        std::vector<std::uint32_t> ready;
+        for (std::uint32_t i = 0; i < n; ++i) if (indeg[i] == 0) ready.push_back(i);
+        while (!ready.empty()) {
+            auto it = std::min_element(ready.begin(), ready.end());
+            const std::uint32_t v = *it;
+            ready.erase(it);
+            m_Order.push_back(v);
+            for (std::uint32_t u : users[v]) if (--indeg[u] == 0) ready.push_back(u);
+        }
+
+        if (m_Order.size() != n) {
+            FK_CORE_WARN("LayerGraph: RunAfter() cycle detected, updating layers serially in stack order");
+            m_Order.clear();
+            for (std::uint32_t i = 0; i < n; ++i) {
+                m_Order.push_back(i);
+                m_Nodes[i].deps.clear();
+                m_Nodes[i].users.clear();
+                if (i > 0) m_Nodes[i].deps.push_back(i - 1);
+                if (i + 1 < n) m_Nodes[i].users.push_back(i + 1);
+            }
+            m_Parallel = false;
+            return;
+        }
+
+        // Worth going wide only if some pair of nodes is unordered, i.e. the
+        // topological order is not a single chain.
+        m_Parallel = false;
+        for (std::uint32_t i = 0; i < n; ++i) {
+            m_Nodes[i].deps = std::move(deps[i]);
+            m_Nodes[i].users = std::move(users[i]);
+            m_Nodes[i].mainThread = !m_Nodes[i].layer || !m_Nodes[i].layer->HasSchedulingInfo();
+        }
+        for (std::size_t k = 1; k < m_Order.size(); ++k) {
+            const auto& d = m_Nodes[m_Order[k]].deps;
+            if (std::find(d.begin(), d.end(), m_Order[k - 1]) == d.end()) { m_Parallel = true; break; }
+        }
+
+        FK_CORE_TRACE("LayerGraph rebuilt: layers={} parallel={}", n, m_Parallel);
+    }
+
+    void LayerGraph::Run(UpdateFn fn, Timestep ts) {
+        JobSystem& js = JobSystem::Get();
+        if (!m_Parallel || !js.IsRunning()) {
+            for (std::uint32_t i : m_Order) {
+                if (Layer* layer = m_Nodes[i].layer) (layer->*fn)(ts);
+            }
+            return;
+        }
+
+        // Dependency counters instead of job handles: whoever finishes a node
+        // releases its users, declared ones go to the job system and the calling
+        // thread runs the rest. It never helps with foreign jobs (a long
+        // OnAsyncUpdate pass would stall the frame).
+        const std::uint32_t n = static_cast<std::uint32_t>(m_Nodes.size());
+        auto frame = std::make_shared<Frame>(n);
+        std::uint32_t live = 0;
+        for (std::uint32_t i = 0; i < n; ++i) {
+            frame->nodes[i].pending.store(static_cast<std::uint32_t>(m_Nodes[i].deps.size()), std::memory_order_relaxed);
+            if (m_Nodes[i].layer) ++live;
+            else frame->nodes[i].claimed.store(true, std::memory_order_relaxed);
+        }
+        frame->remaining.store(live, std::memory_order_release);
+
+        for (std::uint32_t i : m_Order) {
+            if (m_Nodes[i].layer && !m_Nodes[i].mainThread && m_Nodes[i].deps.empty())
+                js.Schedule([this, frame, i, fn, ts] { Execute(frame, i, fn, ts); });
+        }
+
+        while (frame->remaining.load(std::memory_order_acquire) != 0) {
+            bool ran = false;
+            for (std::uint32_t i : m_Order) {
+                NodeState& st = frame->nodes[i];
+                if (st.pending.load(std::memory_order_acquire) != 0 || st.claimed.load(std::memory_order_relaxed)) continue;
+                Execute(frame, i, fn, ts);
+                ran = true;
+            }
+            if (!ran) std::this_thread::yield();
+        }
+    }
+
+    void LayerGraph::Execute(const std::shared_ptr<Frame>& frame, std::uint32_t i, UpdateFn fn, Timestep ts) {
+        // Claimed nodes have been (or are being) run elsewhere; nothing here may
+        // touch the graph before the claim, it can be a leftover from a past frame.
+        if (frame->nodes[i].claimed.exchange(true, std::memory_order_acq_rel)) return;
+        (m_Nodes[i].layer->*fn)(ts);
+        Release(frame, i, fn, ts);
+    }
+
+    void LayerGraph::Release(const std::shared_ptr<Frame>& frame, std::uint32_t i, UpdateFn fn, Timestep ts) {
+        for (std::uint32_t u : m_Nodes[i].users) {
+            if (frame->nodes[u].pending.fetch_sub(1, std::memory_order_acq_rel) == 1 && !m_Nodes[u].mainThread)
+                JobSystem::Get().Schedule([this, frame, u, fn, ts] { Execute(frame, u, fn, ts); });
+        }
+        frame->remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+} // namespace FrameKit
@@ -0,0 +1,77 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Engine/LayerGraph.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  :
+//      Dependency graph over the layer stack for OnSyncUpdate/OnFixedUpdate.
+//      Built from the layers' declared reads/writes and RunAfter() edges, cached
+//      until the stack or a declaration changes. Declared layers run on the
+//      JobSystem; undeclared ones stay on the calling (main) thread.
+// =============================================================================
+
+#pragma once
+
+#include "FrameKit/Engine/Layer.h"
+#include "FrameKit/Engine/JobSystem.h"
+#include "FrameKit/Utilities/Time.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace FrameKit
+{
+    class LayerGraph
+    {
+    public:
+        // Rebuilds only if the stack version or any scheduling declaration changed.
+        // The version guards against a freed layer's address being reused.
+        void Update(const std::vector<Layer*>& layers, std::uint64_t stackVersion);
+
+        using UpdateFn = void (Layer::*)(Timestep);
+
+        // Runs `fn` (OnSyncUpdate, OnFixedUpdate) for every layer, honouring the
+        // graph, and returns once all of them finished. Undeclared layers run
+        // inline on the calling thread; while waiting it only picks up this
+        // frame's layers, never unrelated jobs. Falls back to a serial walk when
+        // nothing can overlap.
+        void Run(UpdateFn fn, Timestep ts);
+
+        FK_NODISCARD bool IsParallel() const noexcept { return m_Parallel; }
+
+    private:
+        struct Node {
+            Layer*                     layer = nullptr;
+            std::vector<std::uint32_t> deps;        // indices into m_Nodes, all earlier in m_Order
+            std::vector<std::uint32_t> users;       // nodes waiting for this one
+            bool                       mainThread = true;   // undeclared: never handed to a worker
+        };
+
+        // Per-run progress. Jobs hold a reference, so one that is still queued
+        // after Run() returned finds its node claimed and does nothing.
+        struct NodeState {
+            std::atomic<std::uint32_t> pending{ 0 };  // unfinished deps
+            std::atomic<bool>          claimed{ false };
+        };
+        struct Frame {
+            explicit Frame(std::size_t n) : nodes(n) {}
+            std::vector<NodeState>     nodes;
+            std::atomic<std::uint32_t> remaining{ 0 };
+        };
+
+        void Build();
+        void Execute(const std::shared_ptr<Frame>& frame, std::uint32_t i, UpdateFn fn, Timestep ts);
+        void Release(const std::shared_ptr<Frame>& frame, std::uint32_t i, UpdateFn fn, Timestep ts);
+
+    private:
+        std::vector<Node>          m_Nodes;          // stack order
+        std::vector<std::uint32_t> m_Order;          // topological order
+        std::vector<std::uint32_t> m_Versions;       // per-layer scheduling version at build time
+        std::uint64_t              m_StackVersion = ~0ull;
+        bool                       m_Parallel = false;
+    };
+} // namespace FrameKit
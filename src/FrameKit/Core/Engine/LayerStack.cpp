@@ -3,67 +3,164 @@
 // File         : src/FrameKit/Engine/LayerStack.cpp
 // Author       : George Gil
 // Created      : 2025-09-08
-// Updated      : 2025-09-10
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : 
-//      Implementation of LayerStack: manages owned Layer* and overlay ordering.
+//      Implementation of LayerStack: manages owned Layer* and overlay ordering,
+//      staged mutations, snapshot publication and deferred layer retirement.
 // =============================================================================
 
 #include "FrameKit/Core/Engine/LayerStack.h"
+#include "FrameKit/Debug/Log.h"
 
-#include <algorithm> // std::find
+#include <algorithm> // std::find, std::remove_if
 
 namespace FrameKit
 {
+    LayerStack::LayerStack()
+        : m_Current(std::make_shared<const Snapshot>()), m_Owner(std::this_thread::get_id()) {
+        m_Published.emplace_back(Acquire());
+    }
+
     LayerStack::~LayerStack() {
-        for (Layer* layer : m_Layers) {
+        // Readers are gone by now; tear down in the same order as before
+        SnapshotPtr current = Acquire();
+        for (Layer* layer : *current) {
             if (layer) {
                 layer->OnDetach();
                 delete layer;
             }
         }
-        m_Layers.clear();
-        m_LayerInsertIndex = 0;
+        for (Retired& r : m_Retired) {
+            if (r.layer) {
+                r.layer->OnDetach();
+                delete r.layer;
+            }
+        }
+        m_Retired.clear();
+
+        // Staged pushes were never attached
+        for (const PendingOp& op : m_Pending) {
+            if (op.kind == OpKind::PushLayer || op.kind == OpKind::PushOverlay) delete op.layer;
+        }
+        m_Pending.clear();
     }
 
-    void LayerStack::PushLayer(Layer* layer) {
-        // Insert before overlays
-        m_Layers.emplace(m_Layers.begin() + static_cast<std::ptrdiff_t>(m_LayerInsertIndex), layer);
-        ++m_LayerInsertIndex;
+    void LayerStack::Stage(OpKind kind, Layer* layer) {
+        {
+            std::scoped_lock<std::mutex> lock(m_PendingMutex);
+            m_Pending.push_back(PendingOp{ kind, layer });
+        }
+        // Owner thread keeps the old synchronous behaviour (OnAttach before
+        // returning). Nested calls from OnAttach stay staged for the next apply.
+        if (std::this_thread::get_id() == m_Owner && !m_Applying) ApplyPending();
     }
 
-    void LayerStack::PushOverlay(Layer* overlay) {
-        // Overlays go to the end
-        m_Layers.emplace_back(overlay);
+    void LayerStack::Publish(SnapshotPtr snapshot) {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        m_Current.store(std::move(snapshot), std::memory_order_release);
+#else
+        std::scoped_lock<std::mutex> lock(m_CurrentMutex);
+        m_Current = std::move(snapshot);
+#endif
     }
 
-    void LayerStack::PopLayer(Layer* layer) {
-        // Search only within the "layers" partition
-        const auto layersEnd = m_Layers.begin() + static_cast<std::ptrdiff_t>(m_LayerInsertIndex);
-        auto it = std::find(m_Layers.begin(), layersEnd, layer);
-        if (it != layersEnd) {
-            if (*it) {
-                (*it)->OnDetach();
-                delete* it;
+    void LayerStack::PushLayer(Layer* layer)     { Stage(OpKind::PushLayer, layer); }
+    void LayerStack::PushOverlay(Layer* overlay) { Stage(OpKind::PushOverlay, overlay); }
+    void LayerStack::PopLayer(Layer* layer)      { Stage(OpKind::PopLayer, layer); }
+    void LayerStack::PopOverlay(Layer* overlay)  { Stage(OpKind::PopOverlay, overlay); }
+
+    bool LayerStack::ApplyPending() {
+        std::vector<PendingOp> ops;
+        {
+            std::scoped_lock<std::mutex> lock(m_PendingMutex);
+            ops.swap(m_Pending);
+        }
+
+        bool changed = false;
+        if (!ops.empty()) {
+            m_Applying = true;
+            const SnapshotPtr current = Acquire();
+            auto next = std::make_shared<Snapshot>(*current);
+            std::vector<Layer*> removed;
+
+            // OnAttach may stage further ops; those land in the next frame
+            for (const PendingOp& op : ops) {
+                auto& v = next->layers;
+                switch (op.kind) {
+                case OpKind::PushLayer:
+                    // Insert before overlays
+                    v.emplace(v.begin() + static_cast<std::ptrdiff_t>(next->overlayBegin), op.layer);
+                    ++next->overlayBegin;
+                    op.layer->OnAttach();
+                    FK_CORE_TRACE("Layer attached: {}", op.layer->GetName());
+                    break;
+                case OpKind::PushOverlay:
+                    // Overlays go to the end
+                    v.emplace_back(op.layer);
+                    op.layer->OnAttach();
+                    FK_CORE_TRACE("Overlay attached: {}", op.layer->GetName());
+                    break;
+                case OpKind::PopLayer: {
+                    // Search only within the "layers" partition
+                    const auto layersEnd = v.begin() + static_cast<std::ptrdiff_t>(next->overlayBegin);
+                    auto it = std::find(v.begin(), layersEnd, op.layer);
+                    if (it == layersEnd) { FK_CORE_WARN("PopLayer: layer not found in stack"); continue; }
+                    v.erase(it);
+                    // One fewer layer before the overlay partition
+                    if (next->overlayBegin > 0) --next->overlayBegin;
+                    removed.push_back(op.layer);
+                    break;
+                }
+                case OpKind::PopOverlay: {
+                    // Search only within the "overlays" partition
+                    const auto overlaysBegin = v.begin() + static_cast<std::ptrdiff_t>(next->overlayBegin);
+                    auto it = std::find(overlaysBegin, v.end(), op.layer);
+                    if (it == v.end()) { FK_CORE_WARN("PopOverlay: overlay not found in stack"); continue; }
+                    v.erase(it);
+                    removed.push_back(op.layer);
+                    break;
+                }
+                }
+                changed = true;
             }
-            m_Layers.erase(it);
-            // One fewer layer before the overlay partition
-            if (m_LayerInsertIndex > 0) {
-                --m_LayerInsertIndex;
+
+            if (changed) {
+                next->version = current->version + 1;
+                SnapshotPtr published = std::move(next);
+                Publish(published);
+
+                // Any older snapshot still alive may reference the removed layers
+                m_Published.erase(std::remove_if(m_Published.begin(), m_Published.end(),
+                    [](const std::weak_ptr<const Snapshot>& w) { return w.expired(); }), m_Published.end());
+                for (Layer* layer : removed) {
+                    m_Retired.push_back(Retired{ layer, m_Published });
+                }
+                m_Published.emplace_back(published);
+                FK_CORE_TRACE("LayerStack v{} published: layers={} retired={}",
+                    published->version, published->Size(), removed.size());
             }
+            m_Applying = false;
         }
+
+        CollectRetired();
+        return changed;
     }
 
-    void LayerStack::PopOverlay(Layer* overlay) {
-        // Search only within the "overlays" partition
-        const auto overlaysBegin = m_Layers.begin() + static_cast<std::ptrdiff_t>(m_LayerInsertIndex);
-        auto it = std::find(overlaysBegin, m_Layers.end(), overlay);
-        if (it != m_Layers.end()) {
-            if (*it) {
-                (*it)->OnDetach();
-                delete* it;
-            }
-            m_Layers.erase(it);
+    void LayerStack::CollectRetired() {
+        if (m_Retired.empty()) return;
+
+        std::vector<Layer*> ready;
+        m_Retired.erase(std::remove_if(m_Retired.begin(), m_Retired.end(), [&ready](const Retired& r) {
+            for (const auto& w : r.readers) if (!w.expired()) return false;
+            ready.push_back(r.layer);
+            return true;
+        }), m_Retired.end());
+
+        for (Layer* layer : ready) {
+            if (!layer) continue;
+            layer->OnDetach();
+            delete layer;
         }
     }
 } // namespace FrameKit
@@ -3,26 +3,48 @@
 // File         : src/FrameKit/Engine/LayerStack.h
 // Author       : George Gil
 // Created      : 2025-09-08
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : 
-//      Container for managing engine layers and overlays. Owns Layer* pointers:
-//      calls OnDetach() and deletes layers on removal and destruction.
+//      Container for managing engine layers and overlays. Owns Layer* pointers.
+//      Readers iterate an immutable, versioned snapshot without locking; pushes
+//      and pops from other threads are staged and applied at a frame boundary.
+//      Removed layers are detached and deleted once no reader holds a snapshot
+//      that still contains them.
 // =============================================================================
 
 #pragma once
 
 #include "FrameKit/Engine/Layer.h"
 
-#include <vector>
+#include <atomic>
 #include <cstddef> // std::size_t
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace FrameKit
 {
     class LayerStack
     {
     public:
-        LayerStack() = default;
+        // Immutable view of the stack. Layers [0, overlayBegin) / overlays [overlayBegin, end)
+        struct Snapshot {
+            std::vector<Layer*> layers;
+            std::size_t         overlayBegin = 0;
+            std::uint64_t       version = 0;
+
+            FK_NODISCARD std::size_t Size() const noexcept { return layers.size(); }
+            FK_NODISCARD std::vector<Layer*>::const_iterator begin() const noexcept { return layers.begin(); }
+            FK_NODISCARD std::vector<Layer*>::const_iterator end()   const noexcept { return layers.end(); }
+            FK_NODISCARD std::vector<Layer*>::const_reverse_iterator rbegin() const noexcept { return layers.rbegin(); }
+            FK_NODISCARD std::vector<Layer*>::const_reverse_iterator rend()   const noexcept { return layers.rend(); }
+        };
+        using SnapshotPtr = std::shared_ptr<const Snapshot>;
+
+        LayerStack();
         ~LayerStack();
 
         // Non-copyable / non-movable: this class OWNS raw Layer*
@@ -31,30 +53,61 @@ namespace FrameKit
         LayerStack(LayerStack&&) = delete;
         LayerStack& operator=(LayerStack&&) = delete;
 
-        // Ownership: pushes transfer ownership of the pointer to LayerStack
+        // Any thread. Ownership of pushed pointers transfers to LayerStack. On the
+        // owner thread (the one that created the stack) the change is applied
+        // right away, so OnAttach() has run on return; elsewhere, and from inside
+        // OnAttach(), it becomes visible after the next ApplyPending().
         void PushLayer(Layer* layer);
         void PushOverlay(Layer* overlay);
-
-        // If found, calls OnDetach() and deletes the owned pointer
         void PopLayer(Layer* layer);
         void PopOverlay(Layer* overlay);
 
-        FK_NODISCARD inline int Size() const noexcept { return m_Layers.size(); }
+        // Any thread. Holding the snapshot keeps every layer in it alive.
+        FK_NODISCARD SnapshotPtr Acquire() const noexcept {
+#if defined(__cpp_lib_atomic_shared_ptr)
+            return m_Current.load(std::memory_order_acquire);
+#else
+            std::scoped_lock<std::mutex> lock(m_CurrentMutex);
+            return m_Current;
+#endif
+        }
+        FK_NODISCARD std::size_t Size() const noexcept { return Acquire()->Size(); }
 
-        // Iteration (non-const)
-        FK_NODISCARD std::vector<Layer*>::iterator begin() noexcept { return m_Layers.begin(); }
-        FK_NODISCARD std::vector<Layer*>::iterator end()   noexcept { return m_Layers.end(); }
-        FK_NODISCARD std::vector<Layer*>::reverse_iterator rbegin() noexcept { return m_Layers.rbegin(); }
-        FK_NODISCARD std::vector<Layer*>::reverse_iterator rend()   noexcept { return m_Layers.rend(); }
+        // Frame-boundary owner thread only. Calls OnAttach() for pushed layers,
+        // publishes a new snapshot if anything changed and then detaches/deletes
+        // retired layers that are no longer visible to any reader.
+        // Returns true if a new snapshot was published.
+        bool ApplyPending();
 
-        // Iteration (const)
-        FK_NODISCARD std::vector<Layer*>::const_iterator begin() const noexcept { return m_Layers.begin(); }
-        FK_NODISCARD std::vector<Layer*>::const_iterator end()   const noexcept { return m_Layers.end(); }
-        FK_NODISCARD std::vector<Layer*>::const_reverse_iterator rbegin() const noexcept { return m_Layers.rbegin(); }
-        FK_NODISCARD std::vector<Layer*>::const_reverse_iterator rend()   const noexcept { return m_Layers.rend(); }
+    private:
+        enum class OpKind : std::uint8_t { PushLayer, PushOverlay, PopLayer, PopOverlay };
+        struct PendingOp { OpKind kind; Layer* layer; };
+
+        struct Retired {
+            Layer*                                    layer = nullptr;
+            std::vector<std::weak_ptr<const Snapshot>> readers; // snapshots that may still reference it
+        };
+
+        void Stage(OpKind kind, Layer* layer);
+        void Publish(SnapshotPtr snapshot);
+        void CollectRetired();
 
     private:
-        std::vector<Layer*> m_Layers;
-        std::size_t         m_LayerInsertIndex = 0; // layers [0, m_LayerInsertIndex) / overlays [m_LayerInsertIndex, end)
+        // libc++ has no std::atomic<shared_ptr>; a short lock around the copy there
+#if defined(__cpp_lib_atomic_shared_ptr)
+        std::atomic<SnapshotPtr>               m_Current;
+#else
+        mutable std::mutex                     m_CurrentMutex;
+        SnapshotPtr                            m_Current;
+#endif
+        std::thread::id                        m_Owner;
+        bool                                   m_Applying = false;   // owner thread only
+
+        std::mutex                             m_PendingMutex;
+        std::vector<PendingOp>                 m_Pending;
+
+        // Owner thread only
+        std::vector<std::weak_ptr<const Snapshot>> m_Published; // live snapshots, pruned on apply
+        std::vector<Retired>                   m_Retired;
     };
 } // namespace FrameKit
@@ -0,0 +1,321 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Events/EventRecorder.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Binary event recording and replay
+// =============================================================================
+
+#include "FrameKit/Events/EventRecorder.h"
+#include "FrameKit/Events/GlobalEventHandler.h"
+#include "FrameKit/Events/ApplicationEvent.h"
+#include "FrameKit/Events/KeyEvent.h"
+#include "FrameKit/Events/MouseEvent.h"
+#include "FrameKit/Events/WindowEvent.h"
+#include "FrameKit/Debug/Log.h"
+
+#include <bit>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+namespace FrameKit {
+
+namespace {
+    using namespace EventRecording;
+
+    // Fields are stored one by one, little-endian, whatever the host byte order
+    template<typename T> struct BitsOf { using type = std::make_unsigned_t<T>; };
+    template<> struct BitsOf<float> { using type = std::uint32_t; };
+    template<typename T> using Bits = typename BitsOf<T>::type;
+
+    struct Writer {
+        std::uint8_t buf[64];
+        std::uint16_t size = 0;
+        template<typename T> void Put(T v) {
+            static_assert(std::is_integral_v<T> || std::is_same_v<T, float>);
+            Bits<T> u;
+            if constexpr (std::is_floating_point_v<T>) u = std::bit_cast<std::uint32_t>(v);
+            else u = static_cast<Bits<T>>(v);
+            for (std::size_t i = 0; i < sizeof(T); ++i) buf[size++] = static_cast<std::uint8_t>(u >> (8 * i));
+        }
+        void PutBytes(const void* src, std::size_t n) {
+            std::memcpy(buf + size, src, n);
+            size = static_cast<std::uint16_t>(size + n);
+        }
+    };
+
+    struct Reader {
+        const std::uint8_t* p;
+        std::size_t         left;
+        template<typename T> T Get() {
+            static_assert(std::is_integral_v<T> || std::is_same_v<T, float>);
+            if (left < sizeof(T)) { left = 0; return T{}; }
+            Bits<T> u = 0;
+            for (std::size_t i = 0; i < sizeof(T); ++i) u = static_cast<Bits<T>>(u | (Bits<T>(p[i]) << (8 * i)));
+            p += sizeof(T);
+            left -= sizeof(T);
+            if constexpr (std::is_floating_point_v<T>) return std::bit_cast<float>(u);
+            else return static_cast<T>(u);
+        }
+    };
+
+    constexpr std::size_t kHeaderBytes = sizeof(FileHeader);
+    constexpr std::size_t kRecordBytes = sizeof(EventRecording::Record);
+
+    // Record header followed by its payload, as one write
+    void WriteRecord(std::FILE* f, RecordKind kind, std::uint8_t type, const Writer& payload) {
+        Writer w;
+        w.Put(static_cast<std::uint8_t>(kind));
+        w.Put(type);
+        w.Put(payload.size);
+        w.PutBytes(payload.buf, payload.size);
+        std::fwrite(w.buf, w.size, 1, f);
+    }
+
+    // Returns false for event types that have no serialised form
+    bool Encode(const Event& e, Writer& w) {
+        switch (e.GetEventType()) {
+        case EventType::WindowClose:
+        case EventType::WindowFocus:
+        case EventType::WindowLostFocus:
+        case EventType::AppTick:
+        case EventType::AppUpdate:
+        case EventType::AppRender:
+            return true;
+        case EventType::WindowResize: {
+            const auto& r = static_cast<const WindowResizeEvent&>(e);
+            w.Put<std::uint32_t>(r.GetWidth()); w.Put<std::uint32_t>(r.GetHeight());
+            return true;
+        }
+        case EventType::WindowMoved: {
+            const auto& m = static_cast<const WindowMovedEvent&>(e);
+            w.Put<std::int32_t>(m.GetX()); w.Put<std::int32_t>(m.GetY());
+            return true;
+        }
+        case EventType::KeyPressed: {
+            const auto& k = static_cast<const KeyPressedEvent&>(e);
+            w.Put(static_cast<std::uint16_t>(k.GetKeyCode())); w.Put<std::int32_t>(k.GetScanCode());
+            w.Put<std::int32_t>(k.GetMods()); w.Put<std::uint8_t>(k.IsRepeat() ? 1 : 0);
+            return true;
+        }
+        case EventType::KeyReleased: {
+            const auto& k = static_cast<const KeyReleasedEvent&>(e);
+            w.Put(static_cast<std::uint16_t>(k.GetKeyCode())); w.Put<std::int32_t>(k.GetScanCode());
+            w.Put<std::int32_t>(k.GetMods());
+            return true;
+        }
+        case EventType::KeyTyped:
+            w.Put<std::uint32_t>(static_cast<const KeyTypedEvent&>(e).GetCodepoint());
+            return true;
+        case EventType::MouseButtonPressed:
+        case EventType::MouseButtonReleased:
+            w.Put(static_cast<std::uint16_t>(static_cast<const MouseButtonEvent&>(e).GetButton()));
+            return true;
+        case EventType::MouseMoved: {
+            // The raw history of a coalesced move is not recorded
+            const auto& m = static_cast<const MouseMovedEvent&>(e);
+            w.Put(m.GetX()); w.Put(m.GetY()); w.Put<std::uint32_t>(m.GetCoalescedCount());
+            return true;
+        }
+        case EventType::MouseScrolled: {
+            const auto& s = static_cast<const MouseScrolledEvent&>(e);
+            w.Put(s.GetXOffset()); w.Put(s.GetYOffset()); w.Put<std::uint32_t>(s.GetCoalescedCount());
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    bool DecodeAndPost(EventType type, Reader r) {
+        auto& events = GlobalEventHandler::Get();
+        switch (type) {
+        case EventType::WindowClose:     events.Post(WindowCloseEvent{}); return true;
+        case EventType::WindowFocus:     events.Post(WindowFocusEvent{}); return true;
+        case EventType::WindowLostFocus: events.Post(WindowLostFocusEvent{}); return true;
+        case EventType::AppTick:         events.Post(AppTickEvent{}); return true;
+        case EventType::AppUpdate:       events.Post(AppUpdateEvent{}); return true;
+        case EventType::AppRender:       events.Post(AppRenderEvent{}); return true;
+        case EventType::WindowResize: {
+            const auto w = r.Get<std::uint32_t>(); const auto h = r.Get<std::uint32_t>();
+            events.Post(WindowResizeEvent(w, h));
+            return true;
+        }
+        case EventType::WindowMoved: {
+            const auto x = r.Get<std::int32_t>(); const auto y = r.Get<std::int32_t>();
+            events.Post(WindowMovedEvent(x, y));
+            return true;
+        }
+        case EventType::KeyPressed: {
+            const auto key = static_cast<KeyCode>(r.Get<std::uint16_t>());
+            const auto sc = r.Get<std::int32_t>(); const auto mods = r.Get<std::int32_t>();
+            const bool repeat = r.Get<std::uint8_t>() != 0;
+            events.Post(KeyPressedEvent(key, sc, mods, repeat));
+            return true;
+        }
+        case EventType::KeyReleased: {
+            const auto key = static_cast<KeyCode>(r.Get<std::uint16_t>());
+            const auto sc = r.Get<std::int32_t>(); const auto mods = r.Get<std::int32_t>();
+            events.Post(KeyReleasedEvent(key, sc, mods));
+            return true;
+        }
+        case EventType::KeyTyped:
+            events.Post(KeyTypedEvent(r.Get<std::uint32_t>()));
+            return true;
+        case EventType::MouseButtonPressed:
+            events.Post(MouseButtonPressedEvent(static_cast<MouseCode>(r.Get<std::uint16_t>())));
+            return true;
+        case EventType::MouseButtonReleased:
+            events.Post(MouseButtonReleasedEvent(static_cast<MouseCode>(r.Get<std::uint16_t>())));
+            return true;
+        case EventType::MouseMoved: {
+            const float x = r.Get<float>(); const float y = r.Get<float>();
+            events.Post(MouseMovedEvent(x, y, r.Get<std::uint32_t>(), nullptr));
+            return true;
+        }
+        case EventType::MouseScrolled: {
+            const float dx = r.Get<float>(); const float dy = r.Get<float>();
+            events.Post(MouseScrolledEvent(dx, dy, r.Get<std::uint32_t>()));
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+}
+
+// ---------------- EventRecorder ----------------
+
+bool EventRecorder::Open(const std::filesystem::path& path) {
+    Close();
+    std::lock_guard lock(m_Mutex);
+    m_File = std::fopen(path.string().c_str(), "wb");
+    if (!m_File) {
+        FK_LOG_ERROR(Events, "EventRecorder: cannot open '{}' for writing", path.string());
+        return false;
+    }
+    std::setvbuf(m_File, nullptr, _IOFBF, 64 * 1024);
+
+    Writer h;
+    h.PutBytes(kMagic, sizeof(kMagic));
+    h.Put(kVersion);
+    h.Put(static_cast<std::uint16_t>(kHeaderBytes));
+    h.Put<std::uint32_t>(0);
+    std::fwrite(h.buf, h.size, 1, m_File);
+
+    m_FrameEvents = 0;
+    m_Frames = m_Events = m_Skipped = 0;
+    FK_LOG_INFO(Events, "Recording events to '{}'", path.string());
+    return true;
+}
+
+void EventRecorder::Close() {
+    std::lock_guard lock(m_Mutex);
+    if (!m_File) return;
+    std::fclose(m_File);
+    m_File = nullptr;
+    FK_LOG_INFO(Events, "Event recording closed: {} frames, {} events ({} skipped)", m_Frames, m_Events, m_Skipped);
+}
+
+void EventRecorder::Record(const Event& e) {
+    Writer w;
+    const bool encoded = Encode(e, w);
+
+    std::lock_guard lock(m_Mutex);
+    if (!m_File) return;
+    if (!encoded) {
+        ++m_Skipped;
+        return;
+    }
+    WriteRecord(m_File, RecordKind::Event, static_cast<std::uint8_t>(e.GetEventType()), w);
+    ++m_FrameEvents;
+    ++m_Events;
+}
+
+void EventRecorder::EndFrame(Timestep dt) {
+    std::lock_guard lock(m_Mutex);
+    if (!m_File) return;
+    Writer fp;
+    fp.Put(dt.Seconds());
+    fp.Put(m_FrameEvents);
+    WriteRecord(m_File, RecordKind::Frame, 0, fp);
+    m_FrameEvents = 0;
+    ++m_Frames;
+}
+
+// ---------------- EventReplayer ----------------
+
+bool EventReplayer::Open(const std::filesystem::path& path) {
+    Close();
+    m_File = std::fopen(path.string().c_str(), "rb");
+    if (!m_File) {
+        FK_LOG_ERROR(Events, "EventReplayer: cannot open '{}'", path.string());
+        return false;
+    }
+    std::setvbuf(m_File, nullptr, _IOFBF, 64 * 1024);
+
+    std::uint8_t raw[kHeaderBytes];
+    FileHeader h{};
+    if (std::fread(raw, sizeof(raw), 1, m_File) == 1) {
+        Reader r{ raw + sizeof(kMagic), sizeof(raw) - sizeof(kMagic) };
+        std::memcpy(h.magic, raw, sizeof(kMagic));
+        h.version = r.Get<std::uint16_t>();
+        h.headerSize = r.Get<std::uint16_t>();
+        h.reserved = r.Get<std::uint32_t>();
+    }
+    if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0) {
+        FK_LOG_ERROR(Events, "EventReplayer: '{}' is not an event recording", path.string());
+        Close();
+        return false;
+    }
+    if (h.version != kVersion) {
+        FK_LOG_ERROR(Events, "EventReplayer: '{}' has version {}, expected {}", path.string(), h.version, kVersion);
+        Close();
+        return false;
+    }
+    std::fseek(m_File, static_cast<long>(h.headerSize), SEEK_SET);
+
+    m_Frames = m_Events = 0;
+    FK_LOG_INFO(Events, "Replaying events from '{}'", path.string());
+    return true;
+}
+
+void EventReplayer::Close() {
+    if (!m_File) return;
+    std::fclose(m_File);
+    m_File = nullptr;
+}
+
+bool EventReplayer::NextFrame(Timestep& dt) {
+    if (!m_File) return false;
+
+    std::uint8_t raw[kRecordBytes];
+    while (std::fread(raw, sizeof(raw), 1, m_File) == 1) {
+        Reader hdr{ raw, sizeof(raw) };
+        EventRecording::Record rec{};
+        rec.kind = static_cast<RecordKind>(hdr.Get<std::uint8_t>());
+        rec.type = hdr.Get<std::uint8_t>();
+        rec.size = hdr.Get<std::uint16_t>();
+        m_Payload.resize(rec.size);
+        if (rec.size && std::fread(m_Payload.data(), rec.size, 1, m_File) != 1) break;
+
+        if (rec.kind == RecordKind::Frame) {
+            Reader r{ m_Payload.data(), m_Payload.size() };
+            dt = Timestep(r.Get<float>());
+            ++m_Frames;
+            return true;
+        }
+        if (rec.kind != RecordKind::Event) {
+            FK_LOG_ERROR(Events, "EventReplayer: unknown record kind {}; stopping", static_cast<int>(rec.kind));
+            break;
+        }
+        if (DecodeAndPost(static_cast<EventType>(rec.type), Reader{ m_Payload.data(), m_Payload.size() })) ++m_Events;
+    }
+    Close();
+    return false;
+}
+
+} // namespace FrameKit
@@ -3,31 +3,306 @@
 // File         : src/FrameKit/Core/Events/GlobalEventHandler.cpp
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-10
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Global event handler
+//      Subscriptions are kept in id order under a mutex; every change rebuilds
+//      the affected per-type dispatch lists and swaps them in atomically.
+//      Replaced lists are freed the next time a change finds no Emit() in
+//      flight.
+//      Deferred mode uses two bump arenas. Producers register as writers of the
+//      active one, bump-allocate the event and link it on that arena's
+//      intrusive MPSC list. Drain() flips the active arena, waits for its
+//      writers to leave, then walks the list in push order and resets it.
 // =============================================================================
 
 #include "FrameKit/Events/GlobalEventHandler.h"
+#include "FrameKit/Debug/Log.h"
+
+#include <algorithm>
+#include <exception>
 
 namespace FrameKit {
 
+namespace {
+    constexpr std::size_t kDefaultArenaBytes = 64 * 1024;
+    constexpr std::size_t kArenaAlign = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    constexpr std::size_t AlignUp(std::size_t v, std::size_t a) noexcept { return (v + a - 1) & ~(a - 1); }
+}
+
 GlobalEventHandler& GlobalEventHandler::Get() {
     static GlobalEventHandler inst;
     return inst;
 }
 
-void GlobalEventHandler::AddListener(const Listener& l) {
+GlobalEventHandler::GlobalEventHandler() {
+    for (auto& l : m_Lists) l.store(new DispatchList(), std::memory_order_relaxed);
+    SetArenaCapacity(kDefaultArenaBytes);
+}
+
+GlobalEventHandler::~GlobalEventHandler() {
+    for (auto& l : m_Lists) delete l.load(std::memory_order_relaxed);
+    for (const DispatchList* l : m_RetiredLists) delete l;
+}
+
+// ---- Subscriptions ----
+
+GlobalEventHandler::ListenerId GlobalEventHandler::Subscribe(EventType type, EventDelegate d) {
+    Subscription sub;
+    sub.kind = SubKind::Type;
+    sub.type = type;
+    sub.fn = d;
+    return AddSubscription(std::move(sub));
+}
+
+GlobalEventHandler::ListenerId GlobalEventHandler::SubscribeCategory(EventCategoryBits mask, EventDelegate d) {
+    Subscription sub;
+    sub.kind = SubKind::Category;
+    sub.mask = mask & ~kCategoryKnown;
+    sub.fn = d;
+    return AddSubscription(std::move(sub));
+}
+
+GlobalEventHandler::ListenerId GlobalEventHandler::SubscribeAll(EventDelegate d) {
+    Subscription sub;
+    sub.kind = SubKind::All;
+    sub.fn = d;
+    return AddSubscription(std::move(sub));
+}
+
+GlobalEventHandler::ListenerId GlobalEventHandler::AddListener(const Listener& l) {
+    Subscription sub;
+    sub.kind = SubKind::All;
+    sub.owned = std::make_unique<Listener>(l);
+    sub.fn = EventDelegate{ [](void* c, Event& e) { (*static_cast<Listener*>(c))(e); }, sub.owned.get() };
+    return AddSubscription(std::move(sub));
+}
+
+GlobalEventHandler::ListenerId GlobalEventHandler::AddSubscription(Subscription sub) {
+    if (!sub.fn) {
+        FK_LOG_WARN(Events, "GlobalEventHandler: ignoring subscription with an empty delegate");
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    sub.id = m_NextId++;
+    const SubKind kind = sub.kind;
+    const EventType type = sub.type;
+    m_Subs.push_back(std::move(sub));
+
+    if (kind == SubKind::Type) {
+        const auto i = static_cast<std::size_t>(type);
+        if (i < kTypeCount) RebuildLocked(i);
+    }
+    else {
+        for (std::size_t i = 0; i < kTypeCount; ++i) RebuildLocked(i);
+    }
+    ReclaimLocked();
+    return m_Subs.back().id;
+}
+
+void GlobalEventHandler::Unsubscribe(ListenerId id) {
     std::lock_guard<std::mutex> lock(m_Mutex);
-    m_Listeners.push_back(l);
+    auto it = std::find_if(m_Subs.begin(), m_Subs.end(), [id](const Subscription& s) { return s.id == id; });
+    if (it == m_Subs.end()) return;
+
+    const SubKind kind = it->kind;
+    const EventType type = it->type;
+    // In-flight Emit() calls may still hold the delegate
+    if (it->owned) m_RetiredOwned.push_back(std::move(it->owned));
+    m_Subs.erase(it);
+
+    if (kind == SubKind::Type) {
+        const auto i = static_cast<std::size_t>(type);
+        if (i < kTypeCount) RebuildLocked(i);
+    }
+    else {
+        for (std::size_t i = 0; i < kTypeCount; ++i) RebuildLocked(i);
+    }
+    ReclaimLocked();
 }
 
-void GlobalEventHandler::Emit(Event& e) {
+void GlobalEventHandler::LearnCategory(std::size_t index, EventCategoryBits flags) {
     std::lock_guard<std::mutex> lock(m_Mutex);
-    for (auto& l : m_Listeners) {
-        l(e);
+    if (m_Categories[index].load(std::memory_order_relaxed) & kCategoryKnown) return;
+    m_Categories[index].store(flags | kCategoryKnown, std::memory_order_release);
+    RebuildLocked(index);
+}
+
+void GlobalEventHandler::RebuildLocked(std::size_t index) {
+    // Category subscribers are only matched once the type's flags have been seen
+    const EventCategoryBits cat = m_Categories[index].load(std::memory_order_relaxed);
+    const bool known = (cat & kCategoryKnown) != 0;
+    const auto type = static_cast<EventType>(index);
+
+    auto* list = new DispatchList();
+    for (const Subscription& s : m_Subs) {
+        bool match = false;
+        switch (s.kind) {
+        case SubKind::Type:     match = s.type == type; break;
+        case SubKind::Category: match = known && (cat & s.mask) != 0; break;
+        case SubKind::All:      match = true; break;
+        }
+        if (match) list->items.push_back(s.fn);
+    }
+    PublishLocked(index, list);
+}
+
+void GlobalEventHandler::PublishLocked(std::size_t index, DispatchList* list) {
+    const DispatchList* old = m_Lists[index].exchange(list, std::memory_order_seq_cst);
+    m_RetiredLists.push_back(old);
+}
+
+void GlobalEventHandler::ReclaimLocked() {
+    // Emit() registers before loading a list, so once no Emit() is in flight
+    // no reader can still see a list that was swapped out above.
+    if (m_ActiveEmits.load(std::memory_order_seq_cst) != 0) return;
+    for (const DispatchList* l : m_RetiredLists) delete l;
+    m_RetiredLists.clear();
+    m_RetiredOwned.clear();
+}
+
+void GlobalEventHandler::Emit(Event& e) {
+    struct EmitScope {
+        std::atomic<std::uint32_t>& n;
+        explicit EmitScope(std::atomic<std::uint32_t>& c) : n(c) { n.fetch_add(1, std::memory_order_seq_cst); }
+        ~EmitScope() { n.fetch_sub(1, std::memory_order_release); }
+    } scope(m_ActiveEmits);
+
+    auto index = static_cast<std::size_t>(e.GetEventType());
+    if (index >= kTypeCount) index = 0;  // unknown types only reach SubscribeAll listeners
+    if (!(m_Categories[index].load(std::memory_order_acquire) & kCategoryKnown)) [[unlikely]]
+        LearnCategory(index, e.GetCategoryFlags());
+
+    const DispatchList* list = m_Lists[index].load(std::memory_order_seq_cst);
+    for (const EventDelegate& d : list->items) {
+        d.fn(d.ctx, e);
         if (e.Handled) break;
     }
 }
 
+void GlobalEventHandler::SetArenaCapacity(std::size_t bytes) {
+    bytes = AlignUp(std::max<std::size_t>(bytes, 1024), kArenaAlign);
+    for (Buffer& b : m_Buffers) {
+        b.mem = std::make_unique<std::byte[]>(bytes);
+        b.capacity = bytes;
+        ResetBuffer(b);
+    }
+}
+
+void GlobalEventHandler::ResetBuffer(Buffer& b) noexcept {
+    b.stub.next.store(nullptr, std::memory_order_relaxed);
+    b.head.store(&b.stub, std::memory_order_relaxed);
+    b.used.store(0, std::memory_order_relaxed);
+    b.woken.store(false, std::memory_order_relaxed);
+}
+
+GlobalEventHandler::Slot GlobalEventHandler::BeginPost(std::size_t size, std::size_t align) {
+    for (;;) {
+        const std::uint32_t idx = m_Active.load(std::memory_order_seq_cst);
+        Buffer& b = m_Buffers[idx];
+        b.writers.fetch_add(1, std::memory_order_seq_cst);
+        // Drain() may have flipped between the load and the registration
+        if (m_Active.load(std::memory_order_seq_cst) != idx) {
+            b.writers.fetch_sub(1, std::memory_order_release);
+            continue;
+        }
+
+        const std::size_t payloadAlign = std::max(align, alignof(QueuedEvent));
+        const std::size_t offset = AlignUp(sizeof(QueuedEvent), payloadAlign);
+        const std::size_t need = offset + size;
+
+        Slot s;
+        s.buffer = &b;
+        if (payloadAlign <= kArenaAlign) {
+            const std::size_t at = b.used.fetch_add(AlignUp(need, kArenaAlign), std::memory_order_relaxed);
+            if (at + need <= b.capacity) {
+                std::byte* base = b.mem.get() + at;
+                s.node = ::new (base) QueuedEvent();
+                s.payload = base + offset;
+                return s;
+            }
+        }
+
+        // Arena exhausted (or over-aligned event): fall back to the heap
+        m_Overflow.fetch_add(1, std::memory_order_relaxed);
+        std::byte* base = static_cast<std::byte*>(::operator new(need, std::align_val_t(payloadAlign)));
+        s.node = ::new (base) QueuedEvent();
+        s.node->heapAlign = payloadAlign;
+        s.payload = base + offset;
+        return s;
+    }
+}
+
+void GlobalEventHandler::EndPost(const Slot& s, Event* e, void (*destroy)(Event*) noexcept) noexcept {
+    s.node->event = e;
+    s.node->destroy = destroy;
+    s.node->next.store(nullptr, std::memory_order_relaxed);
+
+    // Intrusive MPSC push (Vyukov): one exchange, then link the predecessor
+    QueuedEvent* prev = s.buffer->head.exchange(s.node, std::memory_order_acq_rel);
+    prev->next.store(s.node, std::memory_order_release);
+
+    // Posted from another thread: the owner may be idle. Checked before the
+    // writer leaves so Drain() cannot reset the flag underneath us.
+    const bool wake = std::this_thread::get_id() != m_DrainThread.load(std::memory_order_relaxed)
+        && !s.buffer->woken.load(std::memory_order_relaxed)
+        && !s.buffer->woken.exchange(true, std::memory_order_relaxed);
+
+    s.buffer->writers.fetch_sub(1, std::memory_order_release);
+
+    if (wake) {
+        std::scoped_lock<std::mutex> lock(m_WakeMutex);
+        if (m_WakeFn) m_WakeFn(m_WakeCtx);
+    }
+}
+
+void GlobalEventHandler::SetWaker(void (*fn)(void*), void* ctx) {
+    std::scoped_lock<std::mutex> lock(m_WakeMutex);
+    m_WakeFn = fn;
+    m_WakeCtx = ctx;
+}
+
+std::size_t GlobalEventHandler::Drain() {
+    if (m_Draining) {
+        FK_LOG_WARN(Events, "GlobalEventHandler::Drain called re-entrantly; ignored");
+        return 0;
+    }
+    m_Draining = true;
+    m_DrainThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+    const std::uint32_t idx = m_Active.load(std::memory_order_relaxed);
+    m_Active.store(idx ^ 1u, std::memory_order_seq_cst);
+
+    // Producers that registered before the flip finish within a few instructions
+    Buffer& b = m_Buffers[idx];
+    while (b.writers.load(std::memory_order_seq_cst) != 0) FK_CPU_RELAX();
+
+    std::size_t delivered = 0;
+    QueuedEvent* n = b.stub.next.load(std::memory_order_acquire);
+    while (n) {
+        QueuedEvent* next = n->next.load(std::memory_order_acquire);
+        try {
+            Emit(*n->event);
+        }
+        catch (const std::exception& ex) {
+            FK_LOG_ERROR(Events, "Event listener threw on {}: {}", n->event->GetName(), ex.what());
+        }
+        catch (...) {
+            FK_LOG_ERROR(Events, "Event listener threw on {}", n->event->GetName());
+        }
+        n->destroy(n->event);
+
+        const std::size_t heapAlign = n->heapAlign;
+        n->~QueuedEvent();
+        if (heapAlign) ::operator delete(static_cast<void*>(n), std::align_val_t(heapAlign));
+        n = next;
+        ++delivered;
+    }
+    ResetBuffer(b);
+
+    m_Draining = false;
+    return delivered;
+}
+
 } // namespace FrameKit
@@ -0,0 +1,162 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/Events/WindowEventBridge.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Window callback -> global event translation and input coalescing
+// =============================================================================
+
+#include "FrameKit/Window/WindowEventBridge.h"
+#include "FrameKit/Events/WindowEvent.h"
+#include "FrameKit/Events/KeyEvent.h"
+#include "FrameKit/Events/GlobalEventHandler.h"
+#include "FrameKit/Debug/Log.h"
+
+namespace FrameKit {
+
+namespace {
+    EventDelegate s_InputTap{};
+
+    template<typename T>
+    void PostInput(T e) {
+        if (s_InputTap) s_InputTap(e);
+        GlobalEventHandler::Get().Post(std::move(e));
+    }
+
+    void PostCloseReq(const CloseReq&) {
+        PostInput(WindowCloseEvent{});
+    }
+
+    void PostResize(const Resize& r) {
+        PostInput(WindowResizeEvent(static_cast<uint32_t>(r.width), static_cast<uint32_t>(r.height)));
+    }
+
+    void PostKey(const RawKeyEvent& k) {
+        KeyCode kc = ToKeyCodeFromRaw(k.key);
+        if (k.action == 1) {
+            PostInput(KeyPressedEvent(kc, k.scancode, k.mods, false));
+        } else if (k.action == 2) {
+            PostInput(KeyPressedEvent(kc, k.scancode, k.mods, true));
+        } else {
+            PostInput(KeyReleasedEvent(kc, k.scancode, k.mods));
+        }
+    }
+
+    void PostMouseBtn(const RawMouseBtn& b) {
+        MouseCode mb = ToMouseCodeFromRaw(b.button);
+        if (b.action) PostInput(MouseButtonPressedEvent(mb));
+        else          PostInput(MouseButtonReleasedEvent(mb));
+    }
+
+    // IWindow callbacks are plain function pointers (plugin ABI), so they reach
+    // the bridge through the single bound instance.
+    WindowEventBridge* s_Bridge = nullptr;
+
+    template<typename Raw, void (*Post)(const Raw&)>
+    void FlushThenPost(const Raw& r) {
+        if (s_Bridge) s_Bridge->Flush();
+        Post(r);
+    }
+}
+
+void SetWindowInputTap(EventDelegate tap) noexcept {
+    s_InputTap = tap;
+}
+
+void BindWindowToGlobalEvents(IWindow& w) {
+    w.onCloseReq = PostCloseReq;
+    w.onResize = PostResize;
+    w.onKey = PostKey;
+    w.onMouseBtn = PostMouseBtn;
+    w.onMouseMove = [](const RawMouseMove& m) {
+        PostInput(MouseMovedEvent(static_cast<float>(m.x), static_cast<float>(m.y)));
+    };
+    w.onMouseWheel = [](const RawMouseWheel& v) {
+        PostInput(MouseScrolledEvent(static_cast<float>(v.dx), static_cast<float>(v.dy)));
+    };
+}
+
+WindowEventBridge::~WindowEventBridge() {
+    if (s_Bridge == this) s_Bridge = nullptr;
+}
+
+void WindowEventBridge::Bind(IWindow& w, const Settings& s) {
+    m_Settings = s;
+    if (!s.coalesceMouseMove && !s.coalesceScroll) {
+        BindWindowToGlobalEvents(w);
+        return;
+    }
+    if (s_Bridge && s_Bridge != this) {
+        FK_LOG_WARN(Window, "WindowEventBridge: another bridge was bound; it no longer receives input");
+        s_Bridge->Flush();
+    }
+    s_Bridge = this;
+
+    // Everything that is not coalesced flushes first, so listeners still see
+    // input in the order the window produced it.
+    w.onCloseReq = FlushThenPost<CloseReq, PostCloseReq>;
+    w.onResize = FlushThenPost<Resize, PostResize>;
+    w.onKey = FlushThenPost<RawKeyEvent, PostKey>;
+    w.onMouseBtn = FlushThenPost<RawMouseBtn, PostMouseBtn>;
+    w.onMouseMove = [](const RawMouseMove& m) { if (s_Bridge) s_Bridge->OnMouseMove(m); };
+    w.onMouseWheel = [](const RawMouseWheel& v) { if (s_Bridge) s_Bridge->OnMouseWheel(v); };
+}
+
+void WindowEventBridge::OnMouseMove(const RawMouseMove& m) {
+    ++m_RawMoves;
+    const float x = static_cast<float>(m.x);
+    const float y = static_cast<float>(m.y);
+    if (!m_Settings.coalesceMouseMove) {
+        Flush();
+        PostInput(MouseMovedEvent(x, y));
+        return;
+    }
+
+    if (m_MoveCount == 0) {
+        m_MoveFirst = (m_ScrollCount == 0);
+        if (m_Settings.keepMoveHistory) m_MoveHistory = std::make_shared<std::vector<MouseMoveSample>>();
+    }
+    ++m_MoveCount;
+    m_MoveX = x;
+    m_MoveY = y;
+    if (m_MoveHistory) m_MoveHistory->push_back(MouseMoveSample{ x, y });
+}
+
+void WindowEventBridge::OnMouseWheel(const RawMouseWheel& v) {
+    ++m_RawScrolls;
+    const float dx = static_cast<float>(v.dx);
+    const float dy = static_cast<float>(v.dy);
+    if (!m_Settings.coalesceScroll) {
+        Flush();
+        PostInput(MouseScrolledEvent(dx, dy));
+        return;
+    }
+
+    if (m_ScrollCount == 0) m_MoveFirst = (m_MoveCount != 0);
+    ++m_ScrollCount;
+    m_ScrollDx += dx;
+    m_ScrollDy += dy;
+}
+
+void WindowEventBridge::Flush() {
+    if (m_MoveFirst) { FlushMove(); FlushScroll(); }
+    else             { FlushScroll(); FlushMove(); }
+}
+
+void WindowEventBridge::FlushMove() {
+    if (m_MoveCount == 0) return;
+    PostInput(MouseMovedEvent(m_MoveX, m_MoveY, m_MoveCount, std::move(m_MoveHistory)));
+    m_MoveHistory.reset();
+    m_MoveCount = 0;
+}
+
+void WindowEventBridge::FlushScroll() {
+    if (m_ScrollCount == 0) return;
+    PostInput(MouseScrolledEvent(m_ScrollDx, m_ScrollDy, m_ScrollCount));
+    m_ScrollCount = 0;
+    m_ScrollDx = m_ScrollDy = 0.0f;
+}
+
+} // namespace FrameKit
@@ -0,0 +1,242 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/SharedMemory/ShmArena.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Lock-free size-class heap inside a shared-memory segment
+// =============================================================================
+
+#define FK_SHM_BUILD
+#include "FrameKit/SharedMemory/ShmArena.h"
+#include "FrameKit/Core/SharedMemory/ShmLayout.h"
+
+#include <atomic>
+#include <bit>
+#include <new>
+
+// ---- Shared layout ----------------------------------------------------------
+// Every offset is relative to the arena header, so it means the same thing in
+// every process. Blocks are [BlockHeader | payload] carved upwards from the
+// end of the header; each free list is a Treiber stack whose head packs the
+// top block's offset (in 16-byte units) with a counter bumped on every
+// change, so a block popped and pushed back between a reader's load and CAS
+// does not fool the CAS. All counters start at zero, so a zero-filled
+// segment is an empty arena.
+
+namespace {
+
+constexpr uint32_t kArenaMagic   = 0x414E5241u;  // "ARNA"
+constexpr uint32_t kArenaVersion = 1;
+constexpr size_t   kLine         = FK_CACHELINE_SIZE;
+constexpr uint64_t kAlign        = 16;
+
+// Size classes: 16..128 in steps of 16, then four steps per doubling up to 2^40
+constexpr uint32_t kSmallClasses = 8;
+constexpr uint32_t kSmallLog2    = 7;     // kSmallClasses * kAlign == 2^7
+constexpr uint32_t kStepsPerPow2 = 4;
+constexpr uint32_t kClassCount   = kSmallClasses + kStepsPerPow2 * 33;
+constexpr uint64_t kMaxArena     = uint64_t(1) << 40;
+
+constexpr uint64_t kOffsetBits = 40;                      // offset / 16, so up to 16 TiB
+constexpr uint64_t kOffsetMask = (uint64_t(1) << kOffsetBits) - 1;
+
+constexpr uint32_t kBlockLive = 0xA110C8EDu;
+constexpr uint32_t kBlockFree = 0xF4EEB10Cu;
+
+struct ArenaHeader {
+  uint32_t magic;
+  uint32_t version;
+  std::atomic<uint64_t> capacity;                     // bytes of block space after the header
+  alignas(kLine) std::atomic<uint64_t> carved;        // bytes of block space handed out
+  std::atomic<uint64_t> root;                         // offset of the root object, 0 = none
+  alignas(kLine) std::atomic<uint64_t> allocations;
+  std::atomic<uint64_t> frees;
+  alignas(kLine) std::atomic<uint64_t> freeHeads[kClassCount];
+};
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared arena heads must be lock-free");
+
+struct BlockHeader {
+  uint32_t state;   // kBlockLive / kBlockFree; CAS'd so double frees are caught
+  uint32_t cls;
+  uint64_t next;    // free-list link (packed like a head) while free
+};
+static_assert(sizeof(BlockHeader) == kAlign, "block payloads must stay 16-byte aligned");
+
+constexpr uint64_t kHeaderSize = (sizeof(ArenaHeader) + kLine - 1) & ~uint64_t(kLine - 1);
+
+constexpr uint64_t class_size(uint32_t c) noexcept {
+  if (c < kSmallClasses) return uint64_t(c + 1) * kAlign;
+  const uint32_t group = (c - kSmallClasses) / kStepsPerPow2;
+  const uint32_t step = (c - kSmallClasses) % kStepsPerPow2;
+  const uint64_t base = uint64_t(kSmallClasses * kAlign) << group;
+  return base + (step + 1) * (base / kStepsPerPow2);
+}
+
+inline uint32_t class_of(uint64_t n) noexcept {
+  if (n <= kSmallClasses * kAlign) return n == 0 ? 0 : static_cast<uint32_t>((n - 1) / kAlign);
+  const uint32_t log = 63 - static_cast<uint32_t>(std::countl_zero(n - 1));   // base = 2^log < n <= 2^(log+1)
+  const uint64_t base = uint64_t(1) << log;
+  const uint64_t step = base / kStepsPerPow2;
+  return kSmallClasses + (log - kSmallLog2) * kStepsPerPow2 + static_cast<uint32_t>((n - base - 1) / step);
+}
+
+static_assert(class_size(kClassCount - 1) == kMaxArena, "size classes must cover the largest arena");
+
+inline ArenaHeader* header_of(FKShmArenaHeader* a) noexcept { return reinterpret_cast<ArenaHeader*>(a); }
+inline unsigned char* base_of(ArenaHeader* h) noexcept { return reinterpret_cast<unsigned char*>(h); }
+
+inline BlockHeader* block_at(ArenaHeader* h, uint64_t off) noexcept {
+  return reinterpret_cast<BlockHeader*>(base_of(h) + off);
+}
+inline uint64_t pack(uint64_t off, uint64_t tag) noexcept { return (off / kAlign) | (tag << kOffsetBits); }
+inline uint64_t unpack_off(uint64_t head) noexcept { return (head & kOffsetMask) * kAlign; }
+inline uint64_t unpack_tag(uint64_t head) noexcept { return head >> kOffsetBits; }
+
+// Block header for a payload pointer, or nullptr if it cannot be one of ours
+BlockHeader* block_of(ArenaHeader* h, const void* p) noexcept {
+  const auto addr = reinterpret_cast<uintptr_t>(p);
+  const auto first = reinterpret_cast<uintptr_t>(base_of(h)) + kHeaderSize + sizeof(BlockHeader);
+  const uint64_t carved = h->carved.load(std::memory_order_acquire);
+  if (addr < first || addr - first >= carved || (addr - first) % kAlign != 0) return nullptr;
+  return reinterpret_cast<BlockHeader*>(addr - sizeof(BlockHeader));
+}
+
+void* pop_free(ArenaHeader* h, uint32_t cls) noexcept {
+  std::atomic<uint64_t>& head = h->freeHeads[cls];
+  uint64_t cur = head.load(std::memory_order_acquire);
+  for (;;) {
+    const uint64_t off = unpack_off(cur);
+    if (off == 0) return nullptr;
+    BlockHeader* b = block_at(h, off);
+    // May read a block another process just popped; the tag makes our CAS fail then
+    const uint64_t next = std::atomic_ref<uint64_t>(b->next).load(std::memory_order_relaxed);
+    if (head.compare_exchange_weak(cur, pack(unpack_off(next), unpack_tag(cur) + 1),
+                                   std::memory_order_acquire, std::memory_order_acquire)) {
+      std::atomic_ref<uint32_t>(b->state).store(kBlockLive, std::memory_order_relaxed);
+      return b + 1;
+    }
+  }
+}
+
+void push_free(ArenaHeader* h, uint32_t cls, uint64_t off) noexcept {
+  std::atomic<uint64_t>& head = h->freeHeads[cls];
+  BlockHeader* b = block_at(h, off);
+  uint64_t cur = head.load(std::memory_order_relaxed);
+  do {
+    std::atomic_ref<uint64_t>(b->next).store(cur, std::memory_order_relaxed);
+  } while (!head.compare_exchange_weak(cur, pack(off, unpack_tag(cur) + 1),
+                                       std::memory_order_release, std::memory_order_relaxed));
+}
+
+void* carve(ArenaHeader* h, uint32_t cls) noexcept {
+  const uint64_t total = sizeof(BlockHeader) + class_size(cls);
+  uint64_t cur = h->carved.load(std::memory_order_relaxed);
+  do {
+    if (total > h->capacity.load(std::memory_order_relaxed) - cur) return nullptr;
+  } while (!h->carved.compare_exchange_weak(cur, cur + total, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+  BlockHeader* b = block_at(h, kHeaderSize + cur);
+  b->cls = cls;
+  std::atomic_ref<uint64_t>(b->next).store(0, std::memory_order_relaxed);
+  std::atomic_ref<uint32_t>(b->state).store(kBlockLive, std::memory_order_relaxed);
+  return b + 1;
+}
+
+using FrameKit::SHM::detail::aligned_payload;
+using FrameKit::SHM::detail::init_or_validate;
+
+} // namespace
+
+// ---- Public API -------------------------------------------------------------
+extern "C" {
+
+FK_SHM_API int fk_shm_arena_create_or_open(const char* name,
+                                           size_t size,
+                                           FKShmOpenMode mode,
+                                           FKShmHandle* out_handle,
+                                           FKShmArenaHeader** out_arena,
+                                           int* out_created)
+{
+  if (!name || !out_handle || !out_arena || !out_created) return FKSHM_ERR_INVALID_ARG;
+  const uint64_t capacity = uint64_t(size) & ~(kAlign - 1);
+  if (capacity < 2 * kAlign || capacity > kMaxArena) return FKSHM_ERR_INVALID_ARG;
+  *out_handle = nullptr;
+  *out_arena = nullptr;
+  *out_created = 0;
+
+  FKShmHandle shm = nullptr; int created = 0;
+  const int rc = fk_shm_create_or_open(name, kLine + kHeaderSize + capacity, mode, &shm, &created);
+  if (rc != FKSHM_OK) return rc;
+
+  auto* hdr = static_cast<ArenaHeader*>(aligned_payload(shm, kLine));
+  const int vrc = init_or_validate(hdr, created, kArenaMagic, kArenaVersion,
+    [&](ArenaHeader& h) { h.capacity.store(capacity, std::memory_order_relaxed); },
+    [&](ArenaHeader& h) { return h.capacity.load(std::memory_order_relaxed) == capacity; });
+  if (vrc != FKSHM_OK) { fk_shm_close(shm); return vrc; }
+  // The creator may not have finished yet; every opener agrees on the capacity
+  if (!created) hdr->capacity.store(capacity, std::memory_order_relaxed);
+
+  *out_handle = shm;
+  *out_arena = reinterpret_cast<FKShmArenaHeader*>(hdr);
+  *out_created = created;
+  return FKSHM_OK;
+}
+
+FK_SHM_API void* fk_shm_arena_alloc(FKShmArenaHeader* arena, size_t size) {
+  if (!arena || size > kMaxArena) return nullptr;
+  ArenaHeader* h = header_of(arena);
+  const uint32_t cls = class_of(size);
+  void* p = pop_free(h, cls);
+  if (!p) p = carve(h, cls);
+  if (p) h->allocations.fetch_add(1, std::memory_order_relaxed);
+  return p;
+}
+
+FK_SHM_API void fk_shm_arena_free(FKShmArenaHeader* arena, void* ptr) {
+  if (!arena || !ptr) return;
+  ArenaHeader* h = header_of(arena);
+  BlockHeader* b = block_of(h, ptr);
+  if (!b || b->cls >= kClassCount) return;
+  uint32_t live = kBlockLive;
+  if (!std::atomic_ref<uint32_t>(b->state).compare_exchange_strong(live, kBlockFree, std::memory_order_acq_rel)) return;
+  push_free(h, b->cls, static_cast<uint64_t>(reinterpret_cast<unsigned char*>(b) - base_of(h)));
+  h->frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+FK_SHM_API size_t fk_shm_arena_block_size(FKShmArenaHeader* arena, const void* ptr) {
+  if (!arena || !ptr) return 0;
+  BlockHeader* b = block_of(header_of(arena), ptr);
+  if (!b || b->cls >= kClassCount) return 0;
+  return static_cast<size_t>(class_size(b->cls));
+}
+
+FK_SHM_API void* fk_shm_arena_root(FKShmArenaHeader* arena) {
+  if (!arena) return nullptr;
+  ArenaHeader* h = header_of(arena);
+  const uint64_t off = h->root.load(std::memory_order_acquire);
+  return off ? base_of(h) + off : nullptr;
+}
+
+FK_SHM_API int fk_shm_arena_set_root(FKShmArenaHeader* arena, void* expected, void* desired) {
+  if (!arena) return 0;
+  ArenaHeader* h = header_of(arena);
+  auto to_off = [h](void* p) -> uint64_t {
+    return p ? static_cast<uint64_t>(static_cast<unsigned char*>(p) - base_of(h)) : 0;
+  };
+  uint64_t exp = to_off(expected);
+  return h->root.compare_exchange_strong(exp, to_off(desired), std::memory_order_acq_rel) ? 1 : 0;
+}
+
+FK_SHM_API int fk_shm_arena_stats(FKShmArenaHeader* arena, FKShmArenaStats* out_stats) {
+  if (!arena || !out_stats) return FKSHM_ERR_INVALID_ARG;
+  ArenaHeader* h = header_of(arena);
+  out_stats->capacity = h->capacity.load(std::memory_order_relaxed);
+  out_stats->carved = h->carved.load(std::memory_order_relaxed);
+  out_stats->allocations = h->allocations.load(std::memory_order_relaxed);
+  out_stats->frees = h->frees.load(std::memory_order_relaxed);
+  return FKSHM_OK;
+}
+
+} // extern "C"
@@ -0,0 +1,111 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/SharedMemory/ShmEvent.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Cross-process event count on a shared futex word
+// =============================================================================
+
+#define FK_SHM_BUILD
+#include "FrameKit/SharedMemory/ShmEvent.h"
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <thread>
+
+#if defined(FK_PLATFORM_LINUX)
+  #include <cerrno>
+  #include <ctime>
+  #include <linux/futex.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+// The waiter registers (waiters++) before re-checking its condition and the
+// notifier publishes its state before reading `waiters`; both sides are
+// seq_cst, so either the waiter sees the new state or the notifier sees the
+// waiter. The futex itself re-checks `epoch` atomically before sleeping.
+namespace {
+
+constexpr int kSpinRounds = 128;   // epoch checks before parking
+
+inline std::atomic_ref<uint32_t> epoch_of(FKShmEvent* ev) noexcept { return std::atomic_ref<uint32_t>(ev->epoch); }
+inline std::atomic_ref<uint32_t> waiters_of(FKShmEvent* ev) noexcept { return std::atomic_ref<uint32_t>(ev->waiters); }
+
+#if defined(FK_PLATFORM_LINUX)
+// Shared (not FUTEX_PRIVATE) so the wait key is the physical page, valid across processes
+long futex(uint32_t* word, int op, uint32_t val, const timespec* timeout) noexcept {
+  return syscall(SYS_futex, word, op, val, timeout, nullptr, 0);
+}
+#endif
+
+void notify(FKShmEvent* ev, int count) noexcept {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (waiters_of(ev).load(std::memory_order_seq_cst) == 0) return;
+  epoch_of(ev).fetch_add(1, std::memory_order_seq_cst);
+#if defined(FK_PLATFORM_LINUX)
+  futex(&ev->epoch, FUTEX_WAKE, static_cast<uint32_t>(count), nullptr);
+#else
+  (void)count;   // pollers see the epoch change
+#endif
+}
+
+} // namespace
+
+extern "C" {
+
+FK_SHM_API uint32_t fk_shm_event_prepare_wait(FKShmEvent* ev) {
+  if (!ev) return 0;
+  waiters_of(ev).fetch_add(1, std::memory_order_seq_cst);
+  return epoch_of(ev).load(std::memory_order_seq_cst);
+}
+
+FK_SHM_API void fk_shm_event_cancel_wait(FKShmEvent* ev) {
+  if (ev) waiters_of(ev).fetch_sub(1, std::memory_order_seq_cst);
+}
+
+FK_SHM_API int fk_shm_event_wait(FKShmEvent* ev, uint32_t key, int timeout_ms) {
+  if (!ev) return FKSHM_ERR_INVALID_ARG;
+  auto epoch = epoch_of(ev);
+
+  // Short spin first: a producer that is about to publish is cheaper to wait for than a park/wake
+  for (int i = 0; i < kSpinRounds; ++i) {
+    if (epoch.load(std::memory_order_acquire) != key) { fk_shm_event_cancel_wait(ev); return FKSHM_OK; }
+    FK_CPU_RELAX();
+  }
+
+  using Clock = std::chrono::steady_clock;
+  const auto deadline = Clock::now() + std::chrono::milliseconds(timeout_ms < 0 ? 0 : timeout_ms);
+  int rc = FKSHM_OK;
+  while (epoch.load(std::memory_order_acquire) == key) {
+    long long leftNs = LLONG_MAX;
+    if (timeout_ms >= 0) {
+      leftNs = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Clock::now()).count();
+      if (leftNs <= 0) { rc = FKSHM_ERR_TIMEOUT; break; }
+    }
+#if defined(FK_PLATFORM_LINUX)
+    timespec ts{};
+    ts.tv_sec = static_cast<time_t>(leftNs / 1'000'000'000);
+    ts.tv_nsec = static_cast<long>(leftNs % 1'000'000'000);
+    // Returns on wake, on EAGAIN (epoch already moved), EINTR or ETIMEDOUT; the loop sorts it out
+    futex(&ev->epoch, FUTEX_WAIT, key, timeout_ms >= 0 ? &ts : nullptr);
+#else
+    std::this_thread::sleep_for(std::chrono::nanoseconds(leftNs < 200'000 ? leftNs : 200'000));
+#endif
+  }
+  fk_shm_event_cancel_wait(ev);
+  return rc;
+}
+
+FK_SHM_API void fk_shm_event_notify_one(FKShmEvent* ev) {
+  if (ev) notify(ev, 1);
+}
+
+FK_SHM_API void fk_shm_event_notify_all(FKShmEvent* ev) {
+  if (ev) notify(ev, INT_MAX);
+}
+
+} // extern "C"
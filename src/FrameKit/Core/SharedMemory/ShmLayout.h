@@ -0,0 +1,42 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/SharedMemory/ShmLayout.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Header setup for shared-memory structures (private)
+//      A structure's header sits on the first cache-line boundary of the
+//      segment payload (aligned_payload) and carries a magic word and a
+//      layout version. The creator publishes the magic last; openers
+//      validate against it.
+// =============================================================================
+
+#pragma once
+
+#include "FrameKit/SharedMemory/SharedMemory.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace FrameKit::SHM::detail {
+
+// Creator: stamps the version, lets init() fill in the geometry, then
+// publishes the magic. Opener: once the magic is visible, checks the version
+// and matches(); before that the creator is still initializing and the
+// zero-filled header is left alone. Returns an FKSHM_* code.
+template <class H, class Init, class Matches>
+int init_or_validate(H* hdr, int created, uint32_t magic, uint32_t version, Init&& init, Matches&& matches) noexcept {
+  std::atomic_ref<uint32_t> published(hdr->magic);
+  if (created) {
+    hdr->version = version;
+    init(*hdr);
+    published.store(magic, std::memory_order_release);
+    return FKSHM_OK;
+  }
+  if (published.load(std::memory_order_acquire) != magic) return FKSHM_OK;
+  if (hdr->version != version) return FKSHM_ERR_INCOMPATIBLE_VER;
+  return matches(*hdr) ? FKSHM_OK : FKSHM_ERR_LAYOUT_MISMATCH;
+}
+
+} // namespace FrameKit::SHM::detail
@@ -0,0 +1,361 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/SharedMemory/ShmMpmcQueue.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Bounded multi-producer/multi-consumer shared-memory queue
+// =============================================================================
+
+#define FK_SHM_BUILD
+#include "FrameKit/SharedMemory/ShmMpmcQueue.h"
+#include "FrameKit/SharedMemory/ShmEvent.h"
+#include "FrameKit/Core/SharedMemory/ShmLayout.h"
+#include "FrameKit/Core/SharedMemory/ShmProcess.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+// ---- Shared layout ----------------------------------------------------------
+// Slot sequence numbers follow Vyukov's bounded queue: a slot at position p
+// is free for the producer of p when seq == p, holds p's message when
+// seq == p + 1, and is free for the next lap when seq == p + capacity.
+// They are stored minus the slot index so a zero-filled segment is already a
+// valid empty queue and openers never have to wait for the creator.
+// While a process copies a message in or out, the word holds a busy marker
+// with its pid instead. It is installed by a CAS from the expected sequence,
+// so taking the slot and recording the owner is one step, and only a process
+// that found the owner dead may replace it.
+namespace {
+
+constexpr uint32_t kQueueMagic   = 0x51434D46u;  // "FMCQ"
+constexpr uint32_t kQueueVersion = 3;
+constexpr size_t   kLine         = FK_CACHELINE_SIZE;
+
+constexpr uint64_t kBusy    = uint64_t(1) << 63;   // positions never get this far
+constexpr uint64_t kReading = uint64_t(1) << 62;   // busy marker of a consumer (else a producer)
+constexpr uint64_t kPidMask = 0xFFFFFFFFu;
+
+struct QueueHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t slotCount;
+  uint64_t maxMessage;
+  alignas(kLine) std::atomic<uint64_t> enqueuePos;
+  alignas(kLine) std::atomic<uint64_t> dequeuePos;
+  alignas(kLine) std::atomic<uint64_t> fullRejects;
+  std::atomic<uint64_t> highWater;
+  std::atomic<uint64_t> abandoned;
+  alignas(kLine) FKShmEvent notEmpty;   // notified per enqueue, waited on by blocked consumers
+  FKShmEvent               notFull;    // notified per dequeue, waited on by blocked producers
+};
+
+struct Slot {
+  std::atomic<uint64_t> seq;     // logical sequence minus slot index, or a busy marker
+  uint32_t              len;
+  uint32_t              reserved;
+  // message bytes follow
+};
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared queue sequences must be lock-free");
+
+constexpr size_t kHeaderSize = (sizeof(QueueHeader) + kLine - 1) & ~(kLine - 1);
+
+inline size_t slot_stride(size_t maxMessage) noexcept {
+  return (sizeof(Slot) + maxMessage + kLine - 1) & ~(kLine - 1);
+}
+
+using FrameKit::SHM::detail::aligned_payload;
+using FrameKit::SHM::detail::current_pid;
+using FrameKit::SHM::detail::init_or_validate;
+using FrameKit::SHM::detail::process_alive;
+
+int64_t now_ms() noexcept {
+  using namespace std::chrono;
+  return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// A position another process claimed but has not finished, as seen by one handle
+struct StuckWatch {
+  uint64_t pos = ~uint64_t(0);
+  int64_t  sinceMs = 0;
+};
+
+constexpr int64_t kLivenessCheckAfterMs = 10;   // transient stalls are normal; don't probe pids right away
+constexpr int     kRecheckSliceMs = 100;        // parked waiters wake this often to run owner recovery
+
+} // namespace
+
+// ---- Handle -----------------------------------------------------------------
+struct FKShmMpmcQueue_t {
+  FKShmHandle    shm = nullptr;
+  QueueHeader*   hdr = nullptr;
+  unsigned char* slots = nullptr;
+  uint64_t       cap = 0;
+  uint64_t       mask = 0;
+  uint64_t       maxMessage = 0;
+  size_t         stride = 0;
+  uint32_t       pid = 0;
+  uint32_t       abandonTimeoutMs = 1000;
+  StuckWatch     producerWatch;
+  StuckWatch     consumerWatch;
+};
+
+static inline Slot& slot_at(FKShmMpmcQueue q, uint64_t pos) noexcept {
+  return *reinterpret_cast<Slot*>(q->slots + (pos & q->mask) * q->stride);
+}
+// Raw seq word of logical sequence `seq` in the slot of `pos`
+static inline uint64_t stored_seq(FKShmMpmcQueue q, uint64_t pos, uint64_t seq) noexcept {
+  return seq - (pos & q->mask);
+}
+static inline uint64_t busy_marker(uint32_t pid, bool reading) noexcept {
+  return kBusy | (reading ? kReading : 0) | pid;
+}
+static inline bool cas_word(Slot& s, uint64_t from, uint64_t to) noexcept {
+  return s.seq.compare_exchange_strong(from, to, std::memory_order_acq_rel);
+}
+static inline bool cas_seq(FKShmMpmcQueue q, Slot& s, uint64_t pos, uint64_t from, uint64_t to) noexcept {
+  return cas_word(s, stored_seq(q, pos, from), stored_seq(q, pos, to));
+}
+
+// True once the slot at `pos` has been stuck long enough and its owner is
+// gone. owner == 0: the position was claimed but the slot never marked busy.
+static bool owner_abandoned(FKShmMpmcQueue q, StuckWatch& w, uint32_t owner, uint64_t pos) noexcept {
+  const int64_t now = now_ms();
+  if (w.pos != pos) { w.pos = pos; w.sinceMs = now; return false; }
+  const int64_t stuck = now - w.sinceMs;
+  if (stuck < kLivenessCheckAfterMs) return false;
+  if (owner == 0) return stuck >= static_cast<int64_t>(q->abandonTimeoutMs);
+  return owner != q->pid && !process_alive(owner);
+}
+
+static void note_high_water(QueueHeader* hdr, uint64_t pos) noexcept {
+  const uint64_t deq = hdr->dequeuePos.load(std::memory_order_relaxed);
+  const uint64_t size = pos + 1 > deq ? pos + 1 - deq : 0;
+  uint64_t cur = hdr->highWater.load(std::memory_order_relaxed);
+  while (size > cur && !hdr->highWater.compare_exchange_weak(cur, size, std::memory_order_relaxed)) {}
+}
+
+// Retries `attempt` while it reports `busy`, parking on `ev` in between.
+// Slices are capped so a waiter behind an abandoned slot still gets to reclaim it.
+template <class Fn>
+static int wait_for(FKShmEvent* ev, int busy, int timeout_ms, Fn&& attempt) {
+  const int64_t deadline = timeout_ms >= 0 ? now_ms() + timeout_ms : 0;
+  for (;;) {
+    int rc = attempt();
+    if (rc != busy) return rc;
+    const uint32_t key = fk_shm_event_prepare_wait(ev);
+    rc = attempt();
+    if (rc != busy) { fk_shm_event_cancel_wait(ev); return rc; }
+    int slice = kRecheckSliceMs;
+    if (timeout_ms >= 0) {
+      const int64_t left = deadline - now_ms();
+      if (left <= 0) { fk_shm_event_cancel_wait(ev); return FKSHM_ERR_TIMEOUT; }
+      slice = static_cast<int>(std::min<int64_t>(left, slice));
+    }
+    fk_shm_event_wait(ev, key, slice);
+  }
+}
+
+// ---- Public API -------------------------------------------------------------
+extern "C" {
+
+FK_SHM_API int fk_shm_mpmc_create_or_open(const char* name,
+                                          size_t slot_count,
+                                          size_t max_message,
+                                          FKShmOpenMode mode,
+                                          FKShmMpmcQueue* out_queue,
+                                          int* out_created)
+{
+  if (!out_queue || !out_created || !name) return FKSHM_ERR_INVALID_ARG;
+  if (slot_count < 2 || (slot_count & (slot_count - 1)) != 0 || slot_count > (size_t(1) << 32)) return FKSHM_ERR_INVALID_ARG;
+  if (max_message == 0 || max_message > (size_t(1) << 30)) return FKSHM_ERR_INVALID_ARG;
+  *out_queue = nullptr;
+  *out_created = 0;
+
+  const size_t stride = slot_stride(max_message);
+  FKShmHandle shm = nullptr; int created = 0;
+  const int rc = fk_shm_create_or_open(name, kLine + kHeaderSize + slot_count * stride, mode, &shm, &created);
+  if (rc != FKSHM_OK) return rc;
+
+  auto* hdr = static_cast<QueueHeader*>(aligned_payload(shm, kLine));
+  const int vrc = init_or_validate(hdr, created, kQueueMagic, kQueueVersion,
+    [&](QueueHeader& h) { h.slotCount = slot_count; h.maxMessage = max_message; },
+    [&](const QueueHeader& h) { return h.slotCount == slot_count && h.maxMessage == max_message; });
+  if (vrc != FKSHM_OK) { fk_shm_close(shm); return vrc; }
+
+  FKShmMpmcQueue q = new(std::nothrow) FKShmMpmcQueue_t();
+  if (!q) { fk_shm_close(shm); return FKSHM_ERR_SYS; }
+  q->shm = shm;
+  q->hdr = hdr;
+  q->slots = reinterpret_cast<unsigned char*>(hdr) + kHeaderSize;
+  q->cap = slot_count;
+  q->mask = slot_count - 1;
+  q->maxMessage = max_message;
+  q->stride = stride;
+  q->pid = current_pid();
+
+  *out_queue = q;
+  *out_created = created;
+  return FKSHM_OK;
+}
+
+FK_SHM_API void fk_shm_mpmc_close(FKShmMpmcQueue queue) {
+  if (!queue) return;
+  fk_shm_close(queue->shm);
+  delete queue;
+}
+
+FK_SHM_API void fk_shm_mpmc_set_abandon_timeout(FKShmMpmcQueue queue, uint32_t ms) {
+  if (queue) queue->abandonTimeoutMs = ms;
+}
+
+FK_SHM_API int fk_shm_mpmc_try_enqueue(FKShmMpmcQueue q, const void* data, size_t len) {
+  if (!q || (!data && len)) return FKSHM_ERR_INVALID_ARG;
+  if (len > q->maxMessage) return FKSHM_ERR_TOO_LARGE;
+
+  QueueHeader* hdr = q->hdr;
+  uint64_t pos = hdr->enqueuePos.load(std::memory_order_relaxed);
+  Slot* s = nullptr;
+  for (;;) {
+    s = &slot_at(q, pos);
+    const uint64_t raw = s->seq.load(std::memory_order_acquire);
+    const uint64_t prev = pos - q->cap;
+    if (raw & kBusy) {
+      // Behind the cursor, or the previous lap is still being copied. Free
+      // the slot if that was a consumer and it died (its message went with it).
+      const uint64_t cur = hdr->enqueuePos.load(std::memory_order_relaxed);
+      if (cur != pos) { pos = cur; continue; }
+      if ((raw & kReading) && owner_abandoned(q, q->producerWatch, static_cast<uint32_t>(raw & kPidMask), prev)) {
+        if (cas_word(*s, raw, stored_seq(q, pos, pos))) hdr->abandoned.fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
+      hdr->fullRejects.fetch_add(1, std::memory_order_relaxed);
+      return FKSHM_ERR_FULL;
+    }
+
+    const uint64_t seq = raw + (pos & q->mask);
+    const int64_t diff = static_cast<int64_t>(seq - pos);
+    if (diff == 0) {
+      if (hdr->enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+    } else if (diff < 0) {
+      // The previous lap's message is still there. A consumer that claimed
+      // it but never marked the slot busy is given up on after the timeout.
+      if (seq == prev + 1 && hdr->dequeuePos.load(std::memory_order_acquire) > prev &&
+          owner_abandoned(q, q->producerWatch, 0, prev)) {
+        if (cas_seq(q, *s, prev, prev + 1, pos)) hdr->abandoned.fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
+      hdr->fullRejects.fetch_add(1, std::memory_order_relaxed);
+      return FKSHM_ERR_FULL;
+    } else {
+      pos = hdr->enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+
+  // Take the slot before touching it. This only fails if a consumer gave up
+  // on the position while we stalled; the slot may belong to the next lap by now.
+  if (!cas_word(*s, stored_seq(q, pos, pos), busy_marker(q->pid, false))) return FKSHM_ERR_SYS;
+  s->len = static_cast<uint32_t>(len);
+  if (len) std::memcpy(reinterpret_cast<unsigned char*>(s + 1), data, len);
+  if ((pos & 15) == 0) note_high_water(hdr, pos);
+  // Nobody replaces the marker of a live owner
+  s->seq.store(stored_seq(q, pos, pos + 1), std::memory_order_release);
+  fk_shm_event_notify_one(&hdr->notEmpty);
+  return FKSHM_OK;
+}
+
+FK_SHM_API int fk_shm_mpmc_try_dequeue(FKShmMpmcQueue q, void* buf, size_t cap, size_t* out_len) {
+  if (!q || (!buf && cap)) return FKSHM_ERR_INVALID_ARG;
+
+  QueueHeader* hdr = q->hdr;
+  uint64_t pos = hdr->dequeuePos.load(std::memory_order_relaxed);
+  Slot* s = nullptr;
+  for (;;) {
+    s = &slot_at(q, pos);
+    const uint64_t raw = s->seq.load(std::memory_order_acquire);
+    if (raw & kBusy) {
+      // Behind the cursor, or the producer of pos is still copying: skip the
+      // position if that producer died
+      const uint64_t cur = hdr->dequeuePos.load(std::memory_order_relaxed);
+      if (cur != pos) { pos = cur; continue; }
+      if (!(raw & kReading) && owner_abandoned(q, q->consumerWatch, static_cast<uint32_t>(raw & kPidMask), pos)) {
+        uint64_t expected = pos;
+        if (cas_word(*s, raw, stored_seq(q, pos, pos + q->cap))) {
+          hdr->abandoned.fetch_add(1, std::memory_order_relaxed);
+          hdr->dequeuePos.compare_exchange_strong(expected, pos + 1, std::memory_order_relaxed);
+        }
+        pos = hdr->dequeuePos.load(std::memory_order_relaxed);
+        continue;
+      }
+      return FKSHM_ERR_EMPTY;
+    }
+
+    const uint64_t seq = raw + (pos & q->mask);
+    const int64_t diff = static_cast<int64_t>(seq - (pos + 1));
+    if (diff == 0) {
+      if (hdr->dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+    } else if (diff < 0) {
+      // Claimed by a producer that never marked the slot: give up on it after the timeout
+      if (seq == pos && hdr->enqueuePos.load(std::memory_order_acquire) > pos &&
+          owner_abandoned(q, q->consumerWatch, 0, pos)) {
+        uint64_t expected = pos;
+        if (cas_seq(q, *s, pos, pos, pos + q->cap)) {
+          hdr->abandoned.fetch_add(1, std::memory_order_relaxed);
+          hdr->dequeuePos.compare_exchange_strong(expected, pos + 1, std::memory_order_relaxed);
+        }
+        pos = hdr->dequeuePos.load(std::memory_order_relaxed);
+        continue;
+      }
+      return FKSHM_ERR_EMPTY;
+    } else {
+      // Either we are behind, or the slot was given up on and whoever did it
+      // has not advanced the cursor yet; help it along.
+      uint64_t expected = pos;
+      hdr->dequeuePos.compare_exchange_strong(expected, pos + 1, std::memory_order_relaxed);
+      pos = hdr->dequeuePos.load(std::memory_order_relaxed);
+    }
+  }
+
+  // Fails only if a producer gave up on the message while we stalled
+  if (!cas_word(*s, stored_seq(q, pos, pos + 1), busy_marker(q->pid, true))) return FKSHM_ERR_SYS;
+  const size_t len = s->len;
+  if (out_len) *out_len = len;
+  const bool fits = len <= cap;
+  if (fits && len) std::memcpy(buf, reinterpret_cast<const unsigned char*>(s + 1), len);
+  s->seq.store(stored_seq(q, pos, pos + q->cap), std::memory_order_release);
+  fk_shm_event_notify_one(&hdr->notFull);
+  return fits ? FKSHM_OK : FKSHM_ERR_TOO_LARGE;
+}
+
+FK_SHM_API int fk_shm_mpmc_enqueue(FKShmMpmcQueue q, const void* data, size_t len, int timeout_ms) {
+  if (!q) return FKSHM_ERR_INVALID_ARG;
+  return wait_for(&q->hdr->notFull, FKSHM_ERR_FULL, timeout_ms,
+                  [&] { return fk_shm_mpmc_try_enqueue(q, data, len); });
+}
+
+FK_SHM_API int fk_shm_mpmc_dequeue(FKShmMpmcQueue q, void* buf, size_t cap, size_t* out_len, int timeout_ms) {
+  if (!q) return FKSHM_ERR_INVALID_ARG;
+  return wait_for(&q->hdr->notEmpty, FKSHM_ERR_EMPTY, timeout_ms,
+                  [&] { return fk_shm_mpmc_try_dequeue(q, buf, cap, out_len); });
+}
+
+FK_SHM_API int fk_shm_mpmc_stats(FKShmMpmcQueue q, FKShmMpmcStats* out_stats) {
+  if (!q || !out_stats) return FKSHM_ERR_INVALID_ARG;
+  const QueueHeader* hdr = q->hdr;
+  const uint64_t deq = hdr->dequeuePos.load(std::memory_order_acquire);
+  const uint64_t enq = hdr->enqueuePos.load(std::memory_order_acquire);
+  out_stats->capacity = q->cap;
+  out_stats->size = std::min(enq > deq ? enq - deq : 0, q->cap);
+  out_stats->highWater = hdr->highWater.load(std::memory_order_relaxed);
+  out_stats->enqueued = enq;
+  out_stats->dequeued = deq;
+  out_stats->fullRejects = hdr->fullRejects.load(std::memory_order_relaxed);
+  out_stats->abandoned = hdr->abandoned.load(std::memory_order_relaxed);
+  return FKSHM_OK;
+}
+
+} // extern "C"
@@ -0,0 +1,48 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/SharedMemory/ShmProcess.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Process identity for shared-memory ownership
+// =============================================================================
+
+#include "FrameKit/Engine/PlatformDetection.h"
+#include "FrameKit/Core/SharedMemory/ShmProcess.h"
+
+#if defined(FK_PLATFORM_WINDOWS)
+  #ifndef NOMINMAX
+  #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <cerrno>
+  #include <signal.h>
+  #include <unistd.h>
+#endif
+
+namespace FrameKit::SHM::detail {
+
+uint32_t current_pid() noexcept {
+#if defined(FK_PLATFORM_WINDOWS)
+  return static_cast<uint32_t>(GetCurrentProcessId());
+#else
+  return static_cast<uint32_t>(getpid());
+#endif
+}
+
+bool process_alive(uint32_t pid) noexcept {
+#if defined(FK_PLATFORM_WINDOWS)
+  HANDLE h = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, static_cast<DWORD>(pid));
+  if (!h) return GetLastError() == ERROR_ACCESS_DENIED;
+  DWORD code = 0;
+  const bool alive = GetExitCodeProcess(h, &code) && code == STILL_ACTIVE;
+  CloseHandle(h);
+  return alive;
+#else
+  return kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+#endif
+}
+
+} // namespace FrameKit::SHM::detail
@@ -0,0 +1,24 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/SharedMemory/ShmProcess.h
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Process identity for shared-memory ownership (private)
+//      Shared structures record the pid of a process holding a slot or entry
+//      so others can reclaim it once that process is gone.
+// =============================================================================
+
+#pragma once
+
+#include <cstdint>
+
+namespace FrameKit::SHM::detail {
+
+uint32_t current_pid() noexcept;
+
+// True if pid names a running process. A process we may not query counts as alive.
+bool process_alive(uint32_t pid) noexcept;
+
+} // namespace FrameKit::SHM::detail
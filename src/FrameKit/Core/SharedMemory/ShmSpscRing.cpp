@@ -0,0 +1,298 @@
+// =============================================================================
+// Project      : FrameKit
+// File         : src/FrameKit/Core/SharedMemory/ShmSpscRing.cpp
+// Author       : George Gil
+// Created      : 2026-10-16
+// Updated      : 2026-10-16
+// License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
+// Description  : Single-producer/single-consumer shared-memory ring
+// =============================================================================
+
+#define FK_SHM_BUILD
+#include "FrameKit/SharedMemory/ShmSpscRing.h"
+#include "FrameKit/SharedMemory/ShmEvent.h"
+#include "FrameKit/Core/SharedMemory/ShmLayout.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <new>
+
+// ---- Shared layout ----------------------------------------------------------
+// Lives at the first 64-byte boundary of the payload (the mapping itself is
+// page aligned, so every process computes the same offset). Zero-filled is a
+// valid empty ring, so an opener racing the creator never sees garbage.
+namespace {
+
+constexpr uint32_t kRingMagic   = 0x52535046u;  // "FPSR"
+constexpr uint32_t kRingVersion = 2;
+constexpr size_t   kLine        = 64;
+constexpr size_t   kRecHeader   = 8;            // uint32 length + uint32 reserved
+constexpr uint32_t kPadding     = 0xFFFFFFFFu;  // record length marking the skipped tail of the buffer
+
+struct RingHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t kind;
+  uint32_t reserved;
+  uint64_t capacity;
+  alignas(kLine) std::atomic<uint64_t> head;    // bytes published by the producer
+  alignas(kLine) std::atomic<uint64_t> tail;    // bytes released by the consumer
+  alignas(kLine) FKShmEvent readable;           // notified on commit
+  FKShmEvent               writable;           // notified on release
+};                                              // capacity data bytes follow
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared ring cursors must be lock-free");
+
+constexpr size_t kDataOffset = sizeof(RingHeader);   // a multiple of kLine
+
+inline size_t payload_size(size_t capacity) noexcept { return kLine + kDataOffset + capacity; }
+inline size_t align8(size_t n) noexcept { return (n + 7) & ~size_t(7); }
+
+using FrameKit::SHM::detail::aligned_payload;
+using FrameKit::SHM::detail::init_or_validate;
+
+} // namespace
+
+// ---- Handle -----------------------------------------------------------------
+// Each side works on a private cursor and a cached copy of the other side's
+// shared cursor; the shared lines are read only when the cache runs out and
+// written once per commit/release.
+struct FKShmSpscRing_t {
+  FKShmHandle    shm = nullptr;
+  RingHeader*    hdr = nullptr;
+  unsigned char* data = nullptr;
+  uint64_t       cap = 0;
+  uint64_t       mask = 0;
+  FKShmRingKind  kind = FKSHM_RING_MESSAGES;
+
+  // producer
+  uint64_t head = 0;          // write cursor, ahead of hdr->head until commit
+  uint64_t cachedTail = 0;
+
+  // consumer
+  uint64_t tail = 0;          // read cursor, ahead of hdr->tail until release
+  uint64_t cachedHead = 0;
+};
+
+static inline uint32_t load_len(const unsigned char* p) noexcept {
+  uint32_t v; std::memcpy(&v, p, sizeof(v)); return v;
+}
+static inline void store_len(unsigned char* p, uint32_t v) noexcept {
+  std::memcpy(p, &v, sizeof(v));
+  std::memset(p + sizeof(v), 0, kRecHeader - sizeof(v));
+}
+
+// Free bytes from the producer's view, refreshing the cached tail only when needed
+static inline bool has_room(FKShmSpscRing r, uint64_t need) noexcept {
+  if (r->head + need - r->cachedTail <= r->cap) return true;
+  r->cachedTail = r->hdr->tail.load(std::memory_order_acquire);
+  return r->head + need - r->cachedTail <= r->cap;
+}
+
+// Bytes readable from the consumer's view, refreshing the cached head only when needed
+static inline uint64_t available(FKShmSpscRing r) noexcept {
+  if (r->cachedHead == r->tail) r->cachedHead = r->hdr->head.load(std::memory_order_acquire);
+  return r->cachedHead - r->tail;
+}
+
+// ---- Public API -------------------------------------------------------------
+extern "C" {
+
+FK_SHM_API int fk_shm_spsc_create_or_open(const char* name,
+                                          size_t capacity,
+                                          FKShmRingKind kind,
+                                          FKShmOpenMode mode,
+                                          FKShmSpscRing* out_ring,
+                                          int* out_created)
+{
+  if (!out_ring || !out_created || !name) return FKSHM_ERR_INVALID_ARG;
+  if (capacity < 64 || (capacity & (capacity - 1)) != 0 || capacity > (uint64_t(1) << 40)) return FKSHM_ERR_INVALID_ARG;
+  if (kind != FKSHM_RING_MESSAGES && kind != FKSHM_RING_BYTES) return FKSHM_ERR_INVALID_ARG;
+  *out_ring = nullptr;
+  *out_created = 0;
+
+  FKShmHandle shm = nullptr; int created = 0;
+  const int rc = fk_shm_create_or_open(name, payload_size(capacity), mode, &shm, &created);
+  if (rc != FKSHM_OK) return rc;
+
+  // If the creator is still initializing, the payload size already pins the
+  // capacity and zeroed cursors are a valid empty ring
+  auto* hdr = static_cast<RingHeader*>(aligned_payload(shm, kLine));
+  const int vrc = init_or_validate(hdr, created, kRingMagic, kRingVersion,
+    [&](RingHeader& h) { h.kind = static_cast<uint32_t>(kind); h.capacity = capacity; },
+    [&](const RingHeader& h) { return h.kind == static_cast<uint32_t>(kind) && h.capacity == capacity; });
+  if (vrc != FKSHM_OK) { fk_shm_close(shm); return vrc; }
+
+  FKShmSpscRing r = new(std::nothrow) FKShmSpscRing_t();
+  if (!r) { fk_shm_close(shm); return FKSHM_ERR_SYS; }
+  r->shm = shm;
+  r->hdr = hdr;
+  r->data = reinterpret_cast<unsigned char*>(hdr) + kDataOffset;
+  r->cap = capacity;
+  r->mask = capacity - 1;
+  r->kind = kind;
+  r->head = r->cachedHead = hdr->head.load(std::memory_order_acquire);
+  r->tail = r->cachedTail = hdr->tail.load(std::memory_order_acquire);
+
+  *out_ring = r;
+  *out_created = created;
+  return FKSHM_OK;
+}
+
+FK_SHM_API void fk_shm_spsc_close(FKShmSpscRing ring) {
+  if (!ring) return;
+  fk_shm_close(ring->shm);
+  delete ring;
+}
+
+FK_SHM_API size_t fk_shm_spsc_capacity(FKShmSpscRing ring) {
+  return ring ? static_cast<size_t>(ring->cap) : 0;
+}
+
+FK_SHM_API size_t fk_shm_spsc_max_message(FKShmSpscRing ring) {
+  if (!ring || ring->kind != FKSHM_RING_MESSAGES) return 0;
+  return static_cast<size_t>(ring->cap / 2 - kRecHeader);
+}
+
+FK_SHM_API size_t fk_shm_spsc_used(FKShmSpscRing ring) {
+  if (!ring) return 0;
+  const uint64_t t = ring->hdr->tail.load(std::memory_order_acquire);
+  const uint64_t h = ring->hdr->head.load(std::memory_order_acquire);
+  return static_cast<size_t>(h >= t ? h - t : 0);
+}
+
+// ---- Messages ---------------------------------------------------------------
+// A record is an 8-byte header followed by the payload, padded to 8 bytes.
+// A record never wraps: if it does not fit before the end of the buffer the
+// producer fills the rest with a padding record and starts over at 0. Records
+// are at most capacity/2, so an empty ring always has room for one.
+
+FK_SHM_API void* fk_shm_spsc_reserve(FKShmSpscRing ring, size_t len) {
+  if (!ring || ring->kind != FKSHM_RING_MESSAGES) return nullptr;
+  if (len > ring->cap / 2 - kRecHeader) return nullptr;
+
+  const uint64_t rec = align8(kRecHeader + len);
+  const uint64_t pos = ring->head & ring->mask;
+  const uint64_t pad = (ring->cap - pos < rec) ? ring->cap - pos : 0;
+  if (!has_room(ring, pad + rec)) return nullptr;
+
+  unsigned char* p = ring->data + pos;
+  if (pad) {
+    store_len(p, kPadding);
+    ring->head += pad;
+    p = ring->data;
+  }
+  store_len(p, static_cast<uint32_t>(len));
+  ring->head += rec;
+  return p + kRecHeader;
+}
+
+FK_SHM_API void fk_shm_spsc_commit(FKShmSpscRing ring) {
+  if (!ring) return;
+  ring->hdr->head.store(ring->head, std::memory_order_release);
+  fk_shm_event_notify_all(&ring->hdr->readable);
+}
+
+FK_SHM_API int fk_shm_spsc_try_write(FKShmSpscRing ring, const void* data, size_t len) {
+  if (!ring || (!data && len) || ring->kind != FKSHM_RING_MESSAGES) return FKSHM_ERR_INVALID_ARG;
+  if (len > ring->cap / 2 - kRecHeader) return FKSHM_ERR_TOO_LARGE;
+  void* p = fk_shm_spsc_reserve(ring, len);
+  if (!p) return FKSHM_ERR_FULL;
+  if (len) std::memcpy(p, data, len);
+  fk_shm_spsc_commit(ring);
+  return FKSHM_OK;
+}
+
+FK_SHM_API const void* fk_shm_spsc_read(FKShmSpscRing ring, size_t* out_len) {
+  if (!ring || ring->kind != FKSHM_RING_MESSAGES) return nullptr;
+  for (;;) {
+    if (available(ring) == 0) return nullptr;
+    const uint64_t pos = ring->tail & ring->mask;
+    const unsigned char* p = ring->data + pos;
+    const uint32_t len = load_len(p);
+    if (len == kPadding) { ring->tail += ring->cap - pos; continue; }
+    ring->tail += align8(kRecHeader + len);
+    if (out_len) *out_len = len;
+    return p + kRecHeader;
+  }
+}
+
+FK_SHM_API void fk_shm_spsc_release(FKShmSpscRing ring) {
+  if (!ring) return;
+  ring->hdr->tail.store(ring->tail, std::memory_order_release);
+  fk_shm_event_notify_all(&ring->hdr->writable);
+}
+
+FK_SHM_API int fk_shm_spsc_try_read(FKShmSpscRing ring, void* buf, size_t cap, size_t* out_len) {
+  if (!ring || (!buf && cap) || ring->kind != FKSHM_RING_MESSAGES) return FKSHM_ERR_INVALID_ARG;
+  const uint64_t before = ring->tail;
+  size_t len = 0;
+  const void* p = fk_shm_spsc_read(ring, &len);
+  if (!p) {
+    if (ring->tail != before) fk_shm_spsc_release(ring);   // skipped padding
+    return FKSHM_ERR_EMPTY;
+  }
+  if (out_len) *out_len = len;
+  if (len > cap) { ring->tail = before; return FKSHM_ERR_TOO_LARGE; }
+  if (len) std::memcpy(buf, p, len);
+  fk_shm_spsc_release(ring);
+  return FKSHM_OK;
+}
+
+// ---- Bytes ------------------------------------------------------------------
+
+FK_SHM_API size_t fk_shm_spsc_write_bytes(FKShmSpscRing ring, const void* data, size_t len) {
+  if (!ring || !data || ring->kind != FKSHM_RING_BYTES) return 0;
+  if (!has_room(ring, 1)) return 0;
+  const uint64_t n = std::min<uint64_t>(len, ring->cap - (ring->head - ring->cachedTail));
+  const uint64_t pos = ring->head & ring->mask;
+  const uint64_t first = std::min(n, ring->cap - pos);
+  std::memcpy(ring->data + pos, data, static_cast<size_t>(first));
+  std::memcpy(ring->data, static_cast<const unsigned char*>(data) + first, static_cast<size_t>(n - first));
+  ring->head += n;
+  ring->hdr->head.store(ring->head, std::memory_order_release);
+  fk_shm_event_notify_all(&ring->hdr->readable);
+  return static_cast<size_t>(n);
+}
+
+FK_SHM_API size_t fk_shm_spsc_read_bytes(FKShmSpscRing ring, void* buf, size_t cap) {
+  if (!ring || !buf || ring->kind != FKSHM_RING_BYTES) return 0;
+  const uint64_t n = std::min<uint64_t>(cap, available(ring));
+  if (n == 0) return 0;
+  const uint64_t pos = ring->tail & ring->mask;
+  const uint64_t first = std::min(n, ring->cap - pos);
+  std::memcpy(buf, ring->data + pos, static_cast<size_t>(first));
+  std::memcpy(static_cast<unsigned char*>(buf) + first, ring->data, static_cast<size_t>(n - first));
+  ring->tail += n;
+  ring->hdr->tail.store(ring->tail, std::memory_order_release);
+  fk_shm_event_notify_all(&ring->hdr->writable);
+  return static_cast<size_t>(n);
+}
+
+// ---- Blocking ---------------------------------------------------------------
+
+FK_SHM_API int fk_shm_spsc_wait_readable(FKShmSpscRing ring, int timeout_ms) {
+  if (!ring) return FKSHM_ERR_INVALID_ARG;
+  const bool ok = FrameKit::SHM::WaitUntil(ring->hdr->readable, [ring] { return available(ring) != 0; }, timeout_ms);
+  return ok ? FKSHM_OK : FKSHM_ERR_TIMEOUT;
+}
+
+FK_SHM_API int fk_shm_spsc_wait_writable(FKShmSpscRing ring, size_t len, int timeout_ms) {
+  if (!ring) return FKSHM_ERR_INVALID_ARG;
+  uint64_t need = 0;
+  if (ring->kind == FKSHM_RING_MESSAGES) {
+    if (len > ring->cap / 2 - kRecHeader) return FKSHM_ERR_TOO_LARGE;
+    need = align8(kRecHeader + len);
+  } else {
+    need = std::clamp<uint64_t>(len, 1, ring->cap);
+  }
+  const bool ok = FrameKit::SHM::WaitUntil(ring->hdr->writable, [ring, need] {
+    // Re-evaluated each time: the padding needed depends on where the producer stands
+    const uint64_t pos = ring->head & ring->mask;
+    const uint64_t pad = (ring->kind == FKSHM_RING_MESSAGES && ring->cap - pos < need) ? ring->cap - pos : 0;
+    return has_room(ring, pad + need);
+  }, timeout_ms);
+  return ok ? FKSHM_OK : FKSHM_ERR_TIMEOUT;
+}
+
+} // extern "C"
@@ -1,9 +1,9 @@
 // =============================================================================
 // Project      : FrameKit
-// File         : include/FrameKit/Utilities/Time.h
+// File         : src/FrameKit/Core/Utilities/Time.cpp
 // Author       : George Gil
 // Created      : 2025-09-07
-// Updated      : 2025-09-07
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Duration type, stopwatch, and engine clock.
 // =============================================================================
@@ -12,6 +12,16 @@
 
 #include <thread>
 
+#if defined(FK_PLATFORM_WINDOWS)
+  #ifndef NOMINMAX
+  #define NOMINMAX
+  #endif
+  #include <windows.h>
+  #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+  #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+  #endif
+#endif
+
 namespace FrameKit {
 
     // -------- Timer --------
@@ -74,4 +84,64 @@ namespace FrameKit {
         std::this_thread::sleep_for(SecondsF{ dt.Seconds() });
     }
 
+    namespace {
+        using steady = std::chrono::steady_clock;
+
+#if defined(FK_PLATFORM_WINDOWS)
+        // One high-resolution timer per sleeping thread, closed when the thread exits
+        struct ThreadTimer {
+            HANDLE handle = CreateWaitableTimerExW(nullptr, nullptr,
+                CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+
+            ThreadTimer() = default;
+            ~ThreadTimer() { if (handle) CloseHandle(handle); }
+            ThreadTimer(const ThreadTimer&) = delete;
+            ThreadTimer& operator=(const ThreadTimer&) = delete;
+        };
+
+        // Sleep() is tied to the 15.6 ms scheduler tick; a high-resolution
+        // waitable timer (Win10 1803+) gets within ~0.5 ms without timeBeginPeriod.
+        void OsSleepFor(std::chrono::nanoseconds d) noexcept {
+            thread_local ThreadTimer t;
+            const HANDLE timer = t.handle;
+            if (timer) {
+                LARGE_INTEGER due;
+                due.QuadPart = -static_cast<LONGLONG>(d.count() / 100); // relative, 100 ns units
+                if (SetWaitableTimerEx(timer, &due, 0, nullptr, nullptr, nullptr, 0)) {
+                    WaitForSingleObject(timer, INFINITE);
+                    return;
+                }
+            }
+            std::this_thread::sleep_for(d);
+        }
+#else
+        void OsSleepFor(std::chrono::nanoseconds d) noexcept {
+            std::this_thread::sleep_for(d);
+        }
+#endif
+    } // namespace
+
+    std::chrono::nanoseconds SleepUntil(steady::time_point deadline, std::chrono::nanoseconds spinWindow) noexcept {
+        using namespace std::chrono;
+        nanoseconds overshoot{ 0 };
+
+        // Coarse phase
+        const steady::time_point wake = deadline - spinWindow;
+        steady::time_point now = steady::now();
+        if (now < wake) {
+            OsSleepFor(wake - now);
+            now = steady::now();
+            if (now > wake) overshoot = now - wake;
+        }
+
+        // Fine phase: yield while there is room for a reschedule, then spin
+        constexpr auto kYieldMargin = microseconds(100);
+        while (now < deadline) {
+            if (deadline - now > kYieldMargin) std::this_thread::yield();
+            else FK_CPU_RELAX();
+            now = steady::now();
+        }
+        return overshoot;
+    }
+
 } // namespace FrameKit
@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Domains/Window/Backends/Cocoa/CocoaWindow.h
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-10
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Cocoa (macOS) window backend
 // =============================================================================
@@ -25,6 +25,8 @@ public:
     ~CocoaWindow() override;
 
     void poll() override;
+    bool waitEvents(double timeoutSeconds) override;
+    void postEmptyEvent() override;
     bool shouldClose() const override;
     void requestClose() override;
 
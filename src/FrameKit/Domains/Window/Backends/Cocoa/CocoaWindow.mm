@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Domains/Window/Backends/Cocoa/CocoaWindow.mm
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-10
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Cocoa (macOS) window backend implementation
 // =============================================================================
@@ -43,6 +43,31 @@ void CocoaWindow::poll() {
         [m_app sendEvent:event];
     }
 }
+bool CocoaWindow::waitEvents(double timeoutSeconds) {
+    NSDate* until = (timeoutSeconds < 0.0) ? [NSDate distantFuture]
+                                           : [NSDate dateWithTimeIntervalSinceNow:timeoutSeconds];
+    NSEvent* event = [m_app nextEventMatchingMask:NSEventMaskAny untilDate:until inMode:NSDefaultRunLoopMode dequeue:YES];
+    if (!event) return false;
+    [m_app sendEvent:event];
+    poll();
+    return true;
+}
+
+void CocoaWindow::postEmptyEvent() {
+    @autoreleasepool {
+        NSEvent* event = [NSEvent otherEventWithType:NSEventTypeApplicationDefined
+                                            location:NSMakePoint(0, 0)
+                                       modifierFlags:0
+                                           timestamp:0
+                                        windowNumber:0
+                                             context:nil
+                                             subtype:0
+                                               data1:0
+                                               data2:0];
+        [m_app postEvent:event atStart:YES];
+    }
+}
+
 bool CocoaWindow::shouldClose() const { return m_close; }
 void CocoaWindow::requestClose(){ m_close = true; }
 
@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Domains/Window/Backends/GLFW/GlfwWindow.cpp
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : GLFW window backend
 // =============================================================================
@@ -88,18 +88,21 @@ namespace FrameKit {
         // Key input
         glfwSetKeyCallback(m_w, [](GLFWwindow* w, int key, int sc, int action, int mods) {
             if (auto* self = (GlfwWindow*)glfwGetWindowUserPointer(w)) {
+                ++self->m_events;
                 if (self->onKey) self->onKey(RawKeyEvent{ key, sc, action, mods });
             }
         });
         // Mouse buttons
         glfwSetMouseButtonCallback(m_w, [](GLFWwindow* w, int button, int action, int mods) {
             if (auto* self = (GlfwWindow*)glfwGetWindowUserPointer(w)) {
+                ++self->m_events;
                 if (self->onMouseBtn) self->onMouseBtn(RawMouseBtn{ button, action, mods });
             }
         });
         // Cursor motion
         glfwSetCursorPosCallback(m_w, [](GLFWwindow* w, double x, double y) {
             if (auto* self = (GlfwWindow*)glfwGetWindowUserPointer(w)) {
+                ++self->m_events;
                 if (self->onMouseMove) self->onMouseMove(RawMouseMove{ x, y });
             }
         });
@@ -107,6 +110,7 @@ namespace FrameKit {
         // Scroll (high-resolution supported by GLFW)
         glfwSetScrollCallback(m_w, [](GLFWwindow* w, double dx, double dy) {
             if (auto* self = (GlfwWindow*)glfwGetWindowUserPointer(w)) {
+                ++self->m_events;
                 if (self->onMouseWheel) self->onMouseWheel(RawMouseWheel{ dx, dy });
             }
         });
@@ -114,6 +118,7 @@ namespace FrameKit {
         // Resize (logical size)
         glfwSetWindowSizeCallback(m_w, [](GLFWwindow* w, int vw, int vh) {
             if (auto* self = (GlfwWindow*)glfwGetWindowUserPointer(w)) {
+                ++self->m_events;
                 self->m_wd = (uint32_t)vw; self->m_hd = (uint32_t)vh;
                 if (self->onResize) self->onResize(Resize{ vw, vh });
             }
@@ -122,13 +127,22 @@ namespace FrameKit {
         // Content scale changes (per-monitor DPI switches)
         glfwSetWindowContentScaleCallback(m_w, [](GLFWwindow* w, float sx2, float sy2) {
             if (auto* self = (GlfwWindow*)glfwGetWindowUserPointer(w)) {
+                ++self->m_events;
                 self->m_sx = sx2; self->m_sy = sy2;
             }
         });
 
+        // Damage/expose: the contents must be redrawn even without input
+        glfwSetWindowRefreshCallback(m_w, [](GLFWwindow* w) {
+            if (auto* self = (GlfwWindow*)glfwGetWindowUserPointer(w)) {
+                ++self->m_events;
+            }
+        });
+
         // Close request
         glfwSetWindowCloseCallback(m_w, [](GLFWwindow* w) {
             if (auto* self = (GlfwWindow*)glfwGetWindowUserPointer(w)) {
+                ++self->m_events;
                 if (self->onCloseReq) self->onCloseReq(CloseReq{});
                 self->m_close = true;
             }
@@ -145,6 +159,26 @@ namespace FrameKit {
 
     void GlfwWindow::poll() { glfwPollEvents(); }
 
+    bool GlfwWindow::waitEvents(double timeoutSeconds) {
+        const unsigned long long before = m_events;
+        if (timeoutSeconds < 0.0) {
+            glfwWaitEvents();
+            return true;
+        }
+        if (timeoutSeconds == 0.0) {
+            glfwPollEvents();
+            return m_events != before;
+        }
+
+        // GLFW does not report why it returned: an early return means an event
+        // (possibly an empty one from postEmptyEvent), a callback means input.
+        const double start = glfwGetTime();
+        glfwWaitEventsTimeout(timeoutSeconds);
+        return m_events != before || (glfwGetTime() - start) < timeoutSeconds;
+    }
+
+    void GlfwWindow::postEmptyEvent() { glfwPostEmptyEvent(); }
+
     bool GlfwWindow::shouldClose() const {
         return m_close || (m_w && glfwWindowShouldClose(m_w));
     }
@@ -207,7 +241,7 @@ namespace FrameKit {
         // Decide API
         glfwDefaultWindowHints();
         if (rc && rc->api == GraphicsAPI::OpenGL) {
-            FK_CORE_INFO("Creating GLFW window for OpenGL");
+            FK_LOG_INFO(Window, "Creating GLFW window for OpenGL");
             const auto& gl = rc->gl;
             glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_API);
             glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, gl.major);
@@ -216,7 +250,7 @@ namespace FrameKit {
                                                         : GLFW_OPENGL_ANY_PROFILE);
             glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, gl.debug ? GLFW_TRUE : GLFW_FALSE);
         } else {
-            FK_CORE_INFO("Creating GLFW window for Vulkan/No API");
+            FK_LOG_INFO(Window, "Creating GLFW window for Vulkan/No API");
             glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
         }
 
@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Domains/Window/Backends/GLFW/GlfwWindow.h
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-10
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : GLFW window backend
 // =============================================================================
@@ -22,6 +22,8 @@ namespace FrameKit {
         ~GlfwWindow() override;
 
         void poll() override;
+        bool waitEvents(double timeoutSeconds) override;
+        void postEmptyEvent() override;
         bool shouldClose() const override;
         void requestClose() override;
 
@@ -45,6 +47,7 @@ namespace FrameKit {
         float m_sx = 1.0f, m_sy = 1.0f;
         bool m_vsync = true;
         bool m_close = false;
+        unsigned long long m_events = 0;   // bumped by every input callback
     };
 
 } // namespace FrameKit
@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Domains/Window/Backends/Win32/Win32Window.cpp
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Win32 window implementation
 // =============================================================================
@@ -184,6 +184,19 @@ void Win32Window::poll() {
     }
 }
 
+bool Win32Window::waitEvents(double timeoutSeconds) {
+    const DWORD ms = (timeoutSeconds < 0.0) ? INFINITE
+                   : static_cast<DWORD>(timeoutSeconds * 1000.0 + 0.5);
+    // MWMO_INPUTAVAILABLE: also wake for input already seen but not yet removed
+    const DWORD r = MsgWaitForMultipleObjectsEx(0, nullptr, ms, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+    poll();
+    return r != WAIT_TIMEOUT;
+}
+
+void Win32Window::postEmptyEvent() {
+    if (m_hwnd) PostMessageW(m_hwnd, WM_NULL, 0, 0);
+}
+
 bool Win32Window::shouldClose() const { return m_close; }
 void Win32Window::requestClose() { m_close = true; }
 
@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Domains/Window/Backends/Win32/Win32Window.h
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-10
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Win32 window implementation
 // =============================================================================
@@ -22,6 +22,8 @@ public:
     ~Win32Window() override;
 
     void poll() override;
+    bool waitEvents(double timeoutSeconds) override;
+    void postEmptyEvent() override;
     bool shouldClose() const override;
     void requestClose() override;
 
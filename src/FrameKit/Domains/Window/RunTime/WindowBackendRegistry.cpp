@@ -3,7 +3,7 @@
 // File         : src/FrameKit/Domains/Window/RunTime/WindowBackendRegistry.cpp
 // Author       : George Gil
 // Created      : 2025-09-10
-// Updated      : 2025-09-18
+// Updated      : 2026-10-16
 // License      : Dual Licensed: GPLv3 or Proprietary (c) 2025 George Gil
 // Description  : Window backend registry
 // =============================================================================
@@ -63,10 +63,10 @@ namespace FrameKit {
                 if (it->second.prio > bestPrio) { bestPrio = it->second.prio; bestId = cand; }
             }
             if (bestId != WindowAPI::Auto) {
-                FK_CORE_INFO("Selected Window Backend: {}", ToString(bestId));
+                FK_LOG_INFO(Window, "Selected Window Backend: {}", ToString(bestId));
                 return g_map[bestId].fn(d, rc);
             }
-			FK_CORE_ERROR("No valid window backend found for 'Auto' selection");
+			FK_LOG_ERROR(Window, "No valid window backend found for 'Auto' selection");
             return WindowPtr(nullptr, +[](IWindow*) {});
         }
         auto it = g_map.find(id);